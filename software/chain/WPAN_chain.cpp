@@ -8,12 +8,186 @@
 #include "../cse/include/cse_lib.h"
 #include "ldpc_enc/enc_ldpc_ieee_802_11ad.h"
 #include "ldpc_dec/dec_ldpc_ieee_802_11ad.h"
+#include "ldpc_dec/dec_ldpc_ieee_802_11ad_bp.h"
+#include "ldpc_dec/dec_failure_capture.h"
+#include "timing/module_timing.h"
+#include "timing/stat_throughput.h"
+#include "timing/stat_confidence.h"
+#include "timing/status_report.h"
+#include "timing/stat_weighted_error_rates.h"
+#include "timing/stat_error_rates_fast.h"
+#include "channel/channel_awgn_is.h"
+#include "channel/channel_awgn_llr.h"
+#include "channel/demapper_max_log.h"
 
 #include <iostream>
 #include <fstream>
+#include <vector>
+#include <stdexcept>
 
 using namespace cse_lib;
 
+typedef Statistics_Error_Rates_Fast Error_Rates_Type;
+
+
+/// Value of a variant (a single entry applies to all variants).
+static unsigned int Variant_Value(const Buffer<unsigned int>& list, unsigned int variant, unsigned int def)
+{
+	if (list.length() == 0)
+		return def;
+	if (list.length() == 1)
+		return list[0];
+	return list[variant];
+}
+
+
+/// Is there a module section with the given instance name in the configuration?
+static bool Has_Module_Config(Manage_Module_Config& xml_config, const string& instance_name)
+{
+	pugi::xml_node root = xml_config.Get_Inital_Tree();
+
+	for (pugi::xml_node module = root.child("module"); module; module = module.next_sibling("module"))
+		if (instance_name == module.child_value("instance_name"))
+			return true;
+	return false;
+}
+
+
+/// Number of decoder variants requested by the threshold_variants / num_partitions_variants lists.
+static unsigned int Num_Decoder_Variants(Decoder_LDPC_IEEE_802_11ad& decoder)
+{
+	unsigned int num_thresholds = decoder.threshold_variants().length();
+	unsigned int num_partitions = decoder.num_partitions_variants().length();
+
+	if (num_thresholds > 1 && num_partitions > 1 && num_thresholds != num_partitions)
+		throw invalid_argument("\nException[WPAN_chain]: threshold_variants and "
+		                       "num_partitions_variants differ in length!");
+
+	return max(1u, max(num_thresholds, num_partitions));
+}
+
+
+/// File name of a decoder variant, the suffix is inserted before the extension.
+static string Variant_File_Name(const string& file_name, const string& suffix)
+{
+	string::size_type dot   = file_name.rfind('.');
+	string::size_type slash = file_name.rfind('/');
+
+	if (dot == string::npos || (slash != string::npos && dot < slash))
+		return file_name + suffix;
+	return file_name.substr(0, dot) + suffix + file_name.substr(dot);
+}
+
+
+/// Configure all decoder variants and their error rate statistics for the current simulation point.
+/**
+ * Every variant is configured from the XML sections of the primary decoder and
+ * the primary statistics. Afterwards the variant parameters are applied and the
+ * instances are renamed, such that each variant gets its own entry in the result
+ * file. The variants are created on demand and connected to the shared front end.
+ *
+ * If the configuration has a Decoder_LDPC_IEEE_802_11ad_BP section, the BP
+ * reference decoder runs as an additional last variant. It is configured from
+ * the primary decoder section first, so it decodes the same code, and then from
+ * its own section.
+ */
+static void Configure_Decoder_Variants(Manage_Module_Config&              xml_config,
+                                       Buffer<int>&                       input_bits_llr,
+                                       Buffer<unsigned int>&              input_bits_ref,
+                                       Buffer<packed_bit>&                input_bits_ref_packed,
+                                       vector<Decoder_LDPC_IEEE_802_11ad*>& decoders,
+                                       vector<Error_Rates_Type*>&         error_rates)
+{
+	const string decoder_name     = Decoder_LDPC_IEEE_802_11ad::Unique_ID();
+	const string error_rates_name = "error_rates_decoding";
+
+	// The first variant is the decoder as configured in the XML file.
+	decoders[0]->instance_name(decoder_name);
+	xml_config.Configure_Module(*decoders[0]);
+	Buffer<unsigned int> thresholds(decoders[0]->threshold_variants());
+	Buffer<unsigned int> partitions(decoders[0]->num_partitions_variants());
+	unsigned int num_variants = Num_Decoder_Variants(*decoders[0]);
+	unsigned int threshold = decoders[0]->threshold();
+	unsigned int num_partitions = decoders[0]->num_partitions();
+	bool with_bp = Has_Module_Config(xml_config, Decoder_LDPC_IEEE_802_11ad_BP::Unique_ID());
+	unsigned int num_decoders = num_variants + (with_bp ? 1 : 0);
+
+	// The BP decoder is always the last one, release it if it is not needed at this place.
+	if (decoders.size() > 1 &&
+	    dynamic_cast<Decoder_LDPC_IEEE_802_11ad_BP*>(decoders.back()) != NULL &&
+	    (!with_bp || decoders.size() != num_decoders))
+	{
+		delete decoders.back();
+		delete error_rates.back();
+		decoders.pop_back();
+		error_rates.pop_back();
+	}
+
+	// Create missing variants, release unused ones.
+	while (decoders.size() < num_decoders)
+	{
+		if (with_bp && decoders.size() == num_variants)
+			decoders.push_back(new Decoder_LDPC_IEEE_802_11ad_BP);
+		else
+			decoders.push_back(new Decoder_LDPC_IEEE_802_11ad);
+		error_rates.push_back(new Error_Rates_Type);
+		decoders.back()->input_bits_llr(input_bits_llr);
+		error_rates.back()->input_bits_ref(input_bits_ref);
+		error_rates.back()->input_bits_ref_packed(input_bits_ref_packed);
+		error_rates.back()->input_bits(decoders.back()->output_bits());
+		error_rates.back()->input_bits_packed(decoders.back()->output_bits_packed());
+	}
+	while (decoders.size() > num_decoders)
+	{
+		delete decoders.back();
+		delete error_rates.back();
+		decoders.pop_back();
+		error_rates.pop_back();
+	}
+
+	for (unsigned int v = 0; v < num_variants; v++)
+	{
+		decoders[v]->instance_name(decoder_name);
+		error_rates[v]->instance_name(error_rates_name);
+		xml_config.Configure_Module(*decoders[v]);
+		xml_config.Configure_Module(*error_rates[v]);
+
+		// A list with a single entry applies to all variants, also to a single one.
+		decoders[v]->threshold(Variant_Value(thresholds, v, threshold));
+		decoders[v]->num_partitions(Variant_Value(partitions, v, num_partitions));
+
+		if (num_variants == 1)
+			break;
+
+		string suffix = "_threshold_" + Conv_Num_To_Str(decoders[v]->threshold()) +
+		                "_num_partitions_" + Conv_Num_To_Str(decoders[v]->num_partitions());
+		decoders[v]->instance_name(decoder_name + suffix);
+		error_rates[v]->instance_name(error_rates_name + suffix);
+
+		// Each variant traces into its own file.
+		if (!decoders[v]->trace_file().empty())
+			decoders[v]->trace_file(Variant_File_Name(decoders[v]->trace_file(), suffix));
+	}
+
+	if (with_bp)
+	{
+		Decoder_LDPC_IEEE_802_11ad *bp_decoder = decoders[num_variants];
+		const string bp_name = Decoder_LDPC_IEEE_802_11ad_BP::Unique_ID();
+
+		bp_decoder->instance_name(decoder_name);
+		error_rates[num_variants]->instance_name(error_rates_name);
+		xml_config.Configure_Module(*bp_decoder);
+		xml_config.Configure_Module(*error_rates[num_variants]);
+
+		bp_decoder->instance_name(bp_name);
+		xml_config.Configure_Module(*bp_decoder);
+		error_rates[num_variants]->instance_name(error_rates_name + bp_name.substr(decoder_name.length()));
+
+		// Traces hold the data of the hardware check nodes only.
+		bp_decoder->trace_file("");
+	}
+}
+
 int main(int argc, char* argv[]) {
 
 	string configfile = "config.xml";
@@ -32,6 +206,9 @@ int main(int argc, char* argv[]) {
 	// Instantiate modules
 	Source_Bits source_bits;
 
+	// Source bits packed into words, the reference of the error rate statistics.
+	Buffer<packed_bit> source_bits_packed;
+
 	Encoder_LDPC_IEEE_802_11ad encoder;
 
 	Mapper mapper;
@@ -42,23 +219,89 @@ int main(int argc, char* argv[]) {
 
 	Demapper demapper;
 
-	Decoder_LDPC_IEEE_802_11ad decoder;
+	// Importance sampling: biased channel and weighted error rates, only active if configured.
+	Channel_AWGN_IS channel_is;
+	bool importance_sampling = Has_Module_Config(xml_config, channel_is.instance_name());
+	bool weighted_error_rates_configured = Has_Module_Config(xml_config, Statistics_Weighted_Error_Rates::Unique_ID());
+	vector<Statistics_Weighted_Error_Rates*> weighted_error_rates;
+
+	// BPSK/QPSK shortcut: replaces mapper, channel, demapper and converter if configured.
+	Channel_AWGN_LLR channel_llr;
+	bool llr_channel = Has_Module_Config(xml_config, channel_llr.instance_name());
+	if (llr_channel && importance_sampling)
+		throw invalid_argument("\nException[WPAN_chain]: Channel_AWGN_IS and Channel_AWGN_LLR "
+		                       "cannot be used together!");
+
+	// Vectorized max-log demapping: replaces demapper and converter if configured.
+	Demapper_Max_Log demapper_max_log;
+	bool max_log_demapper = Has_Module_Config(xml_config, demapper_max_log.instance_name());
+
+	// All-zero code word mode of Channel_AWGN_LLR: source and encoder are skipped.
+	bool all_zero = false;
+	Buffer<unsigned int> zero_code_word;
 
-	Statistics_Error_Rates<2> error_rates_decoding;
-	error_rates_decoding.instance_name("error_rates_decoding");
+	// Capture of the frames the first decoder variant fails on, only active if configured.
+	Decoder_Failure_Capture failure_capture;
+	bool failure_capture_configured = Has_Module_Config(xml_config, failure_capture.instance_name());
+
+	// Run time measurement, only active if configured.
+	Module_Timing timing;
+	bool timing_configured = Has_Module_Config(xml_config, timing.instance_name());
+
+	// Machine-readable progress, only active if configured.
+	Status_Report status_report;
+	bool status_report_configured = Has_Module_Config(xml_config, status_report.instance_name());
+
+	/*
+	 * Decoder variants: all decoders decode the same channel values, each one
+	 * feeds its own error rate statistics. By default there is only one.
+	 */
+	vector<Decoder_LDPC_IEEE_802_11ad*> decoders(1, new Decoder_LDPC_IEEE_802_11ad);
+	vector<Error_Rates_Type*> error_rates(1, new Error_Rates_Type);
+	error_rates[0]->instance_name("error_rates_decoding");
+
+	// Throughput of each variant, each one times only the calls of its own decoder.
+	vector<Statistics_Throughput*> throughput;
+
+	// Confidence-based stopping of each variant, only active if configured.
+	vector<Statistics_Confidence*> confidence;
+	bool confidence_configured = Has_Module_Config(xml_config, Statistics_Confidence::Unique_ID());
 
 
 	// Connect modules
 	encoder.input_bits(source_bits.output_bits());
+	encoder.input_bits_packed(source_bits_packed);
 	mapper.input_bits(encoder.output_bits());
 	channel.input_symb(mapper.output_symb());
-	demapper.input_symb(channel.output_symb());
+	channel_is.input_symb(mapper.output_symb());
+	if (importance_sampling)
+	{
+		demapper.input_symb(channel_is.output_symb());
+		demapper_max_log.input_symb(channel_is.output_symb());
+	}
+	else
+	{
+		demapper.input_symb(channel.output_symb());
+		demapper_max_log.input_symb(channel.output_symb());
+	}
 	converter.input(demapper.output_bits_llr());
+	channel_llr.input_bits(encoder.output_bits());
+	channel_llr.input_bits_packed(encoder.output_bits_packed());
+
+	// Channel values of the decoders
+	Buffer<int>& bits_llr = llr_channel      ? channel_llr.output_bits_llr() :
+	                        max_log_demapper ? demapper_max_log.output_bits_llr_fixp() :
+	                                           converter.output();
 
-	decoder.input_bits_llr(converter.output());
+	decoders[0]->input_bits_llr(bits_llr);
 
-	error_rates_decoding.input_bits_ref(source_bits.output_bits());
-	error_rates_decoding.input_bits(decoder.output_bits());
+	error_rates[0]->input_bits_ref(source_bits.output_bits());
+	error_rates[0]->input_bits_ref_packed(source_bits_packed);
+	error_rates[0]->input_bits(decoders[0]->output_bits());
+	error_rates[0]->input_bits_packed(decoders[0]->output_bits_packed());
+
+	failure_capture.input_bits_llr(bits_llr);
+	failure_capture.input_bits(decoders[0]->output_bits());
 
 	int result;
 	do {
@@ -67,34 +310,242 @@ int main(int argc, char* argv[]) {
 		xml_config.Configure_Module(encoder);
 		xml_config.Configure_Module(mapper);
 		xml_config.Configure_Module(channel);
+		if (importance_sampling)
+		{
+			xml_config.Configure_Module(channel_is);
+			channel_is.Set_Frame_Index(0);
+		}
+		if (llr_channel)
+		{
+			xml_config.Configure_Module(channel_llr);
+			channel_llr.Set_Frame_Index(0);
+			all_zero = channel_llr.all_zero();
+		}
 		xml_config.Configure_Module(demapper);
 		xml_config.Configure_Module(converter);
-		xml_config.Configure_Module(decoder);
-		xml_config.Configure_Module(error_rates_decoding);
+		if (max_log_demapper)
+		{
+			xml_config.Configure_Module(demapper_max_log);
+			if (!demapper_max_log.fixpoint_output())
+				throw invalid_argument("\nException[WPAN_chain]: Demapper_Max_Log needs "
+				                       "fixpoint_output to feed the decoders!");
+		}
+		Configure_Decoder_Variants(xml_config, bits_llr, source_bits.output_bits(),
+		                           source_bits_packed, decoders, error_rates);
+		for (unsigned int v = 0; v < decoders.size(); v++)
+			error_rates[v]->Zero_Reference(all_zero ? source_bits.num_bits() : 0);
+		if (timing_configured)
+			xml_config.Configure_Module(timing);
+		if (status_report_configured)
+			xml_config.Configure_Module(status_report);
+		if (failure_capture_configured)
+		{
+			xml_config.Configure_Module(failure_capture);
+			if (all_zero)
+			{
+				zero_code_word.Resize(channel_llr.num_bits());
+				zero_code_word.Clear();
+				failure_capture.input_bits_ref(zero_code_word);
+			}
+			else
+				failure_capture.input_bits_ref(encoder.output_bits());
+			if (importance_sampling)
+				failure_capture.Begin_Point(source_bits.start_seed(), channel_is.start_seed(), channel_is.noise_variance());
+			else if (llr_channel)
+				failure_capture.Begin_Point(source_bits.start_seed(), channel_llr.start_seed(), channel_llr.noise_variance());
+			else
+				failure_capture.Begin_Point(source_bits.start_seed(), channel.start_seed(), channel.noise_variance());
+		}
+
+		unsigned int source_bits_id = timing.Module_Id(source_bits.instance_name());
+		unsigned int encoder_id     = timing.Module_Id(encoder.instance_name());
+		unsigned int mapper_id      = timing.Module_Id(mapper.instance_name());
+		unsigned int channel_id     = timing.Module_Id(channel.instance_name());
+		unsigned int demapper_id    = timing.Module_Id(demapper.instance_name());
+		unsigned int converter_id   = timing.Module_Id(converter.instance_name());
+		vector<unsigned int> decoder_ids(decoders.size());
+		for (unsigned int v = 0; v < decoders.size(); v++)
+			decoder_ids[v] = timing.Module_Id(decoders[v]->instance_name());
+		timing.Reset();
+
+		while (throughput.size() < decoders.size())
+			throughput.push_back(new Statistics_Throughput);
+		while (throughput.size() > decoders.size())
+		{
+			delete throughput.back();
+			throughput.pop_back();
+		}
+		for (unsigned int v = 0; v < decoders.size(); v++)
+		{
+			throughput[v]->instance_name("throughput" +
+				decoders[v]->instance_name().substr(Decoder_LDPC_IEEE_802_11ad::Unique_ID().length()));
+			throughput[v]->Reset();
+		}
+
+		while (confidence.size() < decoders.size())
+			confidence.push_back(new Statistics_Confidence);
+		while (confidence.size() > decoders.size())
+		{
+			delete confidence.back();
+			confidence.pop_back();
+		}
+		for (unsigned int v = 0; v < decoders.size(); v++)
+		{
+			confidence[v]->instance_name(Statistics_Confidence::Unique_ID());
+			if (confidence_configured)
+				xml_config.Configure_Module(*confidence[v]);
+			confidence[v]->instance_name("confidence" +
+				decoders[v]->instance_name().substr(Decoder_LDPC_IEEE_802_11ad::Unique_ID().length()));
+			confidence[v]->Reset();
+		}
+
+		if (importance_sampling)
+		{
+			while (weighted_error_rates.size() < decoders.size())
+				weighted_error_rates.push_back(new Statistics_Weighted_Error_Rates);
+			while (weighted_error_rates.size() > decoders.size())
+			{
+				delete weighted_error_rates.back();
+				weighted_error_rates.pop_back();
+			}
+			for (unsigned int v = 0; v < decoders.size(); v++)
+			{
+				weighted_error_rates[v]->instance_name(Statistics_Weighted_Error_Rates::Unique_ID());
+				if (weighted_error_rates_configured)
+					xml_config.Configure_Module(*weighted_error_rates[v]);
+				weighted_error_rates[v]->instance_name("weighted_error_rates_decoding" +
+					decoders[v]->instance_name().substr(Decoder_LDPC_IEEE_802_11ad::Unique_ID().length()));
+				weighted_error_rates[v]->input_bits(decoders[v]->output_bits());
+				weighted_error_rates[v]->input_bits_ref(source_bits.output_bits());
+				weighted_error_rates[v]->input_log_weight(channel_is.output_log_weight());
+				weighted_error_rates[v]->Reset();
+			}
+		}
+
+		status_report.Begin_Point(xml_config);
+		for (unsigned int v = 0; v < decoders.size(); v++)
+			status_report.Watch(*error_rates[v], decoders[v]->num_iterations(), *throughput[v],
+			                    confidence[v], importance_sampling ? weighted_error_rates[v] : NULL);
 
 		//RNG_reset();
 
+		/*
+		 * A variant that reached its stopping criterion is not decoded anymore, so
+		 * its statistics are those of a standalone run of the same configuration.
+		 */
+		vector<bool> finished(decoders.size(), false);
+
 		do {
-			source_bits.Run();
-			encoder.Run();
-			mapper.Run();
+			if (!all_zero)
+			{
+				timing.Run_Module(source_bits, source_bits_id);
+				source_bits_packed.Pack(source_bits.output_bits());
+				timing.Run_Module(encoder, encoder_id);
+			}
+
+			if (llr_channel)
+				timing.Run_Module(channel_llr, channel_id);
+			else
+			{
+				timing.Run_Module(mapper, mapper_id);
 
-			channel.Run();
+				if (importance_sampling)
+					timing.Run_Module(channel_is, channel_id);
+				else
+					timing.Run_Module(channel, channel_id);
 
-			demapper.Run();
-			converter.Run();
-			decoder.Run();
+				if (max_log_demapper)
+					timing.Run_Module(demapper_max_log, demapper_id);
+				else
+				{
+					timing.Run_Module(demapper, demapper_id);
+					timing.Run_Module(converter, converter_id);
+				}
+			}
 
+			// Stop the simulation point when all variants have reached their stopping criterion.
+			bool primary_decoded = !finished[0];
+			result = 1;
+			for (unsigned int v = 0; v < decoders.size(); v++)
+			{
+				if (finished[v])
+					continue;
 
-			result = error_rates_decoding.Run(); 
+				throughput[v]->Start_Frame();
+				timing.Run_Module(*decoders[v], decoder_ids[v]);
+				throughput[v]->Count_Frame(source_bits.num_bits(),
+				                           decoders[v]->iterations_performed().Read());
+
+				/*
+				 * A variant is done at the limits of its statistics or at the target precision.
+				 * With importance sampling the unweighted error rates are biased, the
+				 * weighted error rates and their variance decide.
+				 */
+				bool done = (error_rates[v]->Run() != 0);
+				if (importance_sampling)
+				{
+					Statistics_Weighted_Error_Rates &weighted = *weighted_error_rates[v];
+
+					done = (weighted.Run() != 0);
+					done = confidence[v]->Check_Weighted(weighted.num_total_blocks().Read(),
+					                                     weighted.num_diff_blocks().Read(),
+					                                     weighted.error_rate_blocks().Read(),
+					                                     weighted.error_rate_blocks_variance().Read()) || done;
+				}
+				else
+					done = confidence[v]->Check(error_rates[v]->num_total_blocks().Read(),
+					                            error_rates[v]->num_diff_blocks(decoders[v]->num_iterations())().Read()) || done;
+				if (done)
+					finished[v] = true;
+				else
+					result = 0;
+			}
+
+			// The capture follows the primary decoder, it stops with it.
+			if (failure_capture_configured && primary_decoded)
+				failure_capture.Run();
+
+			status_report.Run();
 		} while (result == 0);
 
+		status_report.End_Point();
+
 		xml_result.Create_Iteration_Value_Result_Point(xml_config);  // Create a new iteration value XML tree to store the modules results (uses xml_config to as a template for results)
-		xml_result.Insert_Results_From_Module(error_rates_decoding); // Insert the results from a Module into the current working tree
-		xml_result.Insert_Results_From_Module(decoder); // Insert the results from a Module into the current working tree
+		for (unsigned int v = 0; v < decoders.size(); v++)
+		{
+			xml_result.Insert_Results_From_Module(*error_rates[v]); // Insert the results from a Module into the current working tree
+			xml_result.Insert_Results_From_Module(*decoders[v]); // Insert the results from a Module into the current working tree
+			throughput[v]->Run();
+			xml_result.Insert_Results_From_Module(*throughput[v]);
+			confidence[v]->Run();
+			xml_result.Insert_Results_From_Module(*confidence[v]);
+			if (importance_sampling)
+				xml_result.Insert_Results_From_Module(*weighted_error_rates[v]);
+		}
+		if (importance_sampling)
+			xml_result.Insert_Results_From_Module(channel_is);
+		if (failure_capture_configured)
+			xml_result.Insert_Results_From_Module(failure_capture);
+		if (timing.enabled())
+		{
+			timing.Run();
+			xml_result.Insert_Results_From_Module(timing);
+		}
 		xml_result.Write_Current_State(); // Write the current XML result tree into the current working tree
 	} while (xml_config.Update_To_Next_Iter() == 0); // Update configuration instance with the next iteration point
 
+	status_report.Finish();
+
+	for (unsigned int v = 0; v < decoders.size(); v++)
+	{
+		delete decoders[v];
+		delete error_rates[v];
+		delete throughput[v];
+		delete confidence[v];
+	}
+	for (unsigned int v = 0; v < weighted_error_rates.size(); v++)
+		delete weighted_error_rates[v];
+
 	return 0;
 }
 
@@ -0,0 +1,101 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  AWGN channel with importance sampling
+/// \date   2026/10/19
+//
+
+#include <cmath>
+
+#include "channel_awgn_is.h"
+
+using namespace hlp_fct::logging;
+using namespace std;
+
+namespace cse_lib {
+
+void Channel_AWGN_IS::Init()
+{
+	unsigned int num_symbols = input_symb().length();
+
+	rand_gen_.reset(start_seed());
+	std_deviation_ = sqrt(noise_variance() / 2.0);
+
+	try
+	{
+		output_symb().Resize(num_symbols);
+		output_log_weight().Resize(1);
+		symbol_bias_.Resize(num_symbols);
+		noise_.Resize(2 * num_symbols);
+	}
+	catch(bad_alloc&)
+	{
+		Msg(ERROR, instance_name(), "Memory allocation failure!");
+		throw;
+	}
+
+	symbol_bias_.Clear();
+	for (unsigned int i = 0; i < biased_symbols().length(); i++)
+	{
+		if (biased_symbols()[i] >= num_symbols)
+		{
+			Msg(ERROR, instance_name(), "Biased symbol " + Conv_Num_To_Str(biased_symbols()[i]) +
+			                            " exceeds the frame length!");
+			throw invalid_argument("\nException[Channel_AWGN_IS]: biased symbol out of range!");
+		}
+		symbol_bias_[biased_symbols()[i]] = bias();
+	}
+
+	mean_log_weight().Reset();
+
+	param_list_.config_modified(false);
+	input_data_list_.port_modified(false);
+}
+
+
+int Channel_AWGN_IS::Run()
+{
+	double log_weight = 0.0;
+
+	if (param_list_.config_modified() || input_data_list_.port_modified() ||
+	    symbol_bias_.length() != input_symb().length())
+		Init();
+
+	double variance = static_cast<double>(std_deviation_) * std_deviation_;
+
+	// Noise of the whole frame, I and Q of symbol i at 2 i and 2 i + 1.
+	rand_gen_.set_stream(frame_index_++);
+	rand_gen_.get_random(&noise_[0], noise_.length());
+
+	for (unsigned int i = 0; i < input_symb().length(); i++)
+	{
+		complex<float> symb = input_symb()[i];
+		double noise[2] = { noise_[2 * i] * std_deviation_, noise_[2 * i + 1] * std_deviation_ };
+
+		if (symbol_bias_[i] != 0.0f)
+		{
+			// Mean of the biased noise in each dimension.
+			double mean[2] = { - symbol_bias_[i] * symb.real(), - symbol_bias_[i] * symb.imag() };
+
+			/*
+			 * Likelihood ratio p(n) / q(n) of the zero mean density p and the
+			 * shifted density q: ln w = (mean^2 - 2 n mean) / (2 variance).
+			 */
+			for (unsigned int d = 0; d < 2; d++)
+			{
+				noise[d] += mean[d];
+				log_weight += (mean[d] * mean[d] - 2.0 * noise[d] * mean[d]) / (2.0 * variance);
+			}
+		}
+
+		output_symb()[i] = complex<float>(symb.real() + noise[0], symb.imag() + noise[1]);
+	}
+
+	output_log_weight()[0] = log_weight;
+	mean_log_weight().Write(log_weight);
+
+	return 0;
+}
+}
@@ -0,0 +1,80 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  AWGN channel with importance sampling
+/// \date   2026/10/19
+//
+
+#ifndef CHANNEL_AWGN_IS_H_
+#define CHANNEL_AWGN_IS_H_
+
+#include "channel_awgn_is_iface.h"
+#include "channel_awgn_is_param.h"
+#include "../assistance/counter_random_generator.h"
+
+
+namespace cse_lib {
+
+/// SISO AWGN channel with mean-shifted noise for importance sampling
+/**
+ * Adds Gaussian noise like Channel_AWGN, but the noise of the symbols listed
+ * in biased_symbols is drawn from a Gaussian with the mean -bias * s, where s
+ * is the transmitted symbol. Errors on these symbols, e.g. the variable nodes
+ * of a trapping set, become frequent.
+ *
+ * For each frame the logarithm of the likelihood ratio weight
+ * w = p(n) / q(n) of the drawn noise n is written to output_log_weight. The
+ * weighted error counts of Statistics_Weighted_Error_Rates give an unbiased
+ * estimate of the error rates of the unbiased channel.
+ *
+ * The noise of each frame is drawn from its own substream (start_seed, frame
+ * index) of a Counter_Random_Generator, the frame index is incremented with
+ * each Run(). Set_Frame_Index() selects the frame index of the next frame,
+ * e.g., to start each simulation point at frame 0, to recreate a captured
+ * frame or to distribute frames over several channel instances. The noise
+ * of a frame is generated in one call with the vectorized bulk function of the
+ * generator.
+ *
+ * \ingroup modules
+ */
+class Channel_AWGN_IS : public Channel_AWGN_IS_Interface,
+                        public Channel_AWGN_IS_Parameter
+{
+
+public:
+
+	Channel_AWGN_IS() : frame_index_(0) { }
+
+	virtual ~Channel_AWGN_IS() { }
+
+	int Run();
+
+	/// Select the noise substream of the next frame.
+	void Set_Frame_Index(ull_int frame_index) { frame_index_ = frame_index; }
+
+	/// Frame index of the next frame.
+	ull_int Frame_Index() const { return frame_index_; }
+
+private:
+
+	void Init();
+
+	// Random generator of the noise
+	Counter_Random_Generator rand_gen_;
+
+	// Substream of the next frame
+	ull_int frame_index_;
+
+	// Unit variance noise of a frame
+	Buffer<float> noise_;
+
+	// Standard deviation of each dimension
+	float std_deviation_;
+
+	// Bias of each symbol, 0 for unbiased symbols
+	Buffer<float> symbol_bias_;
+};
+}
+#endif // CHANNEL_AWGN_IS_H_
@@ -0,0 +1,52 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Interface of the AWGN channel with importance sampling
+/// \date   2026/10/19
+//
+
+#ifndef CHANNEL_AWGN_IS_IFACE_H_
+#define CHANNEL_AWGN_IS_IFACE_H_
+
+#include <complex>
+#include "../modules/base/base_iface.h"
+
+
+namespace cse_lib {
+
+/// Interface of the AWGN channel with importance sampling
+/**
+ * \ingroup interface
+ */
+class Channel_AWGN_IS_Interface : public Base_Interface
+{
+
+public:
+
+	Channel_AWGN_IS_Interface()
+	{
+		input_symb.Register("input_symb", input_data_list_);
+		output_symb.Register("output_symb", output_data_list_);
+		output_log_weight.Register("output_log_weight", output_data_list_);
+
+		mean_log_weight.Register("mean_log_weight", status_out_list_);
+	}
+
+	virtual ~Channel_AWGN_IS_Interface() {}
+
+	/// Complex input symbols
+	Data_In<complex<float> > input_symb;
+
+	/// Complex output symbols with added noise
+	Data_Out<complex<float> > output_symb;
+
+	/// Natural logarithm of the likelihood ratio weight of the frame, one value
+	Data_Out<double> output_log_weight;
+
+	/// Mean logarithm of the likelihood ratio weights
+	Status_Out<double, 0, Status_Out_Plugin_Mean> mean_log_weight;
+};
+}
+#endif // CHANNEL_AWGN_IS_IFACE_H_
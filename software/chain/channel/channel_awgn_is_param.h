@@ -0,0 +1,85 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Parameters of the AWGN channel with importance sampling
+/// \date   2026/10/19
+//
+
+#ifndef CHANNEL_AWGN_IS_PARAM_H_
+#define CHANNEL_AWGN_IS_PARAM_H_
+
+#include "cse_lib.h"
+
+
+namespace cse_lib {
+
+/// Parameter class of the AWGN channel with importance sampling
+/**
+ * \ingroup parameter
+ */
+class Channel_AWGN_IS_Parameter : public Base_Parameter
+{
+
+public:
+
+	Channel_AWGN_IS_Parameter()
+	{
+		instance_name(Unique_ID());
+		Set_Default_Values();
+	}
+
+	virtual ~Channel_AWGN_IS_Parameter(){}
+
+	/// Unique identification string of the module.
+	static std::string Unique_ID(){ return "Channel_AWGN_IS";}
+
+
+	/**************
+	 * Parameters *
+	 **************/
+
+	/// Start seed of the noise generator
+	Param<unsigned int> start_seed;
+
+	/// Variance of the channel. The variance is separated to the two dimensions (I and Q).
+	Param<float> noise_variance;
+
+	/// Mean shift of the noise of the biased symbols, in multiples of the transmitted symbol
+	/**
+	 * The noise of a biased symbol s has the mean -bias * s, i.e., a bias of
+	 * 1.0 moves a BPSK or QPSK symbol onto the decision boundary on average.
+	 */
+	Param<float> bias;
+
+	/// Indices of the biased symbols, e.g. the variable nodes of a trapping set for BPSK
+	Param<Buffer<unsigned int> > biased_symbols;
+
+
+protected:
+
+
+	/******************
+	 * Default values *
+	 ******************/
+
+	/// Set all parameters to their default values.
+	/**
+	 * Default values:
+	 *  - start_seed     : 12424
+	 *  - noise_variance : 1.0
+	 *  - bias           : 0.5
+	 *  - biased_symbols : (empty)
+	 */
+	void Set_Default_Values()
+	{
+		start_seed.Init(12424, "start_seed", param_list_);
+		noise_variance.Init(1.0, "noise_variance", param_list_);
+		bias.Init(0.5, "bias", param_list_);
+		biased_symbols.Init(Buffer<unsigned int>(), "biased_symbols", param_list_);
+	}
+
+};
+}
+#endif // CHANNEL_AWGN_IS_PARAM_H_
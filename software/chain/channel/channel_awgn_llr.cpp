@@ -0,0 +1,143 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Fused BPSK/QPSK AWGN channel with quantized LLR output
+/// \date   2026/10/19
+//
+
+#include <cmath>
+
+#include "channel_awgn_llr.h"
+
+using namespace hlp_fct::logging;
+using namespace std;
+
+namespace cse_lib {
+
+unsigned int Channel_AWGN_LLR::Frame_Length()
+{
+	if (all_zero() && num_bits() > 0)
+		return num_bits();
+	if (input_bits_packed().length() > 0)
+		return input_bits_packed().length();
+	return input_bits().length();
+}
+
+
+void Channel_AWGN_LLR::Init()
+{
+	unsigned int num_bits = Frame_Length();
+
+	switch(mapping())
+	{
+	case Mapper_Share::MAP_BPSK:
+		bits_per_symbol_ = 1;
+		amplitude_ = 1.0f;
+		break;
+
+	case Mapper_Share::MAP_QPSK:
+		bits_per_symbol_ = 2;
+		amplitude_ = 1.0f / sqrt(2.0f);
+		break;
+
+	default:
+		Msg(ERROR, instance_name(), "Only MAP_BPSK and MAP_QPSK are supported!");
+		throw invalid_argument("\nException[Channel_AWGN_LLR]: unsupported mapping!");
+	}
+
+	if (num_bits % bits_per_symbol_ != 0)
+	{
+		Msg(ERROR, instance_name(), "The number of bits is no multiple of the bits per symbol!");
+		throw invalid_argument("\nException[Channel_AWGN_LLR]: padding is not supported!");
+	}
+
+	if (num_bits == 0 && all_zero())
+	{
+		Msg(ERROR, instance_name(), "The all-zero mode needs num_bits or input_bits!");
+		throw invalid_argument("\nException[Channel_AWGN_LLR]: frame length is unknown!");
+	}
+
+	rand_gen_.reset(start_seed());
+	std_deviation_ = sqrt(noise_variance() / 2.0);
+	llr_factor_ = 4.0f * amplitude_ / noise_variance();
+
+	try
+	{
+		noise_.Resize(2 * (num_bits / bits_per_symbol_));
+		bits_llr_.Resize(num_bits);
+	}
+	catch(bad_alloc&)
+	{
+		Msg(ERROR, instance_name(), "Memory allocation failure!");
+		throw;
+	}
+
+	converter_.instance_name(instance_name() + "_converter");
+	converter_.bw_output(bw_output());
+	converter_.bw_output_fract(bw_output_fract());
+	converter_.input(bits_llr_);
+
+	param_list_.config_modified(false);
+	input_data_list_.port_modified(false);
+}
+
+
+int Channel_AWGN_LLR::Run()
+{
+	if (param_list_.config_modified() || input_data_list_.port_modified() ||
+	    bits_llr_.length() != Frame_Length())
+		Init();
+
+	// Noise of the whole frame, I and Q of symbol i at 2 i and 2 i + 1.
+	rand_gen_.set_stream(frame_index_++);
+	rand_gen_.get_random(&noise_[0], noise_.length());
+
+	// All-zero code word: every bit is sent as +amplitude, the I and Q noise is used in turn.
+	if (all_zero())
+	{
+		unsigned int num_bits = bits_llr_.length();
+
+		if (bits_per_symbol_ == 1)
+			for (unsigned int b = 0; b < num_bits; b++)
+				bits_llr_[b] = llr_factor_ * (amplitude_ + noise_[2 * b] * std_deviation_);
+		else
+			for (unsigned int b = 0; b < num_bits; b++)
+				bits_llr_[b] = llr_factor_ * (amplitude_ + noise_[b] * std_deviation_);
+
+		converter_.Run();
+		output_bits_llr() = converter_.output();
+
+		return 0;
+	}
+
+	/*
+	 * Bit b of a symbol is transmitted as amplitude * (1 - 2 b), BPSK only uses
+	 * the I dimension, QPSK the I dimension for the first and the Q dimension
+	 * for the second bit of a symbol.
+	 */
+	Buffer<unsigned int> &bits = input_bits();
+	Buffer<packed_bit> &bits_packed = input_bits_packed();
+	bool packed = (bits_packed.length() > 0);
+	unsigned int num_symbols = bits_llr_.length() / bits_per_symbol_;
+
+	for (unsigned int i = 0; i < num_symbols; i++)
+	{
+		for (unsigned int d = 0; d < bits_per_symbol_; d++)
+		{
+			unsigned int b = i * bits_per_symbol_ + d;
+			unsigned int bit = packed ? bits_packed[b] : bits[b];
+			float symb = (bit == 0) ? amplitude_ : -amplitude_;
+			float received = symb + noise_[2 * i + d] * std_deviation_;
+
+			bits_llr_[b] = llr_factor_ * received;
+		}
+	}
+
+	converter_.Run();
+	output_bits_llr() = converter_.output();
+
+	return 0;
+}
+}
@@ -0,0 +1,99 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Fused BPSK/QPSK AWGN channel with quantized LLR output
+/// \date   2026/10/19
+//
+
+#ifndef CHANNEL_AWGN_LLR_H_
+#define CHANNEL_AWGN_LLR_H_
+
+#include "channel_awgn_llr_iface.h"
+#include "channel_awgn_llr_param.h"
+#include "../assistance/counter_random_generator.h"
+
+
+namespace cse_lib {
+
+/// Mapper, AWGN channel, demapper and fixpoint conversion in one module
+/**
+ * For BPSK and QPSK the chain Mapper, Channel_AWGN, Demapper and
+ * Converter_Float_Fixpoint computes quantize(scale * (s + n)) per code bit,
+ * with the symbol amplitude s = +-1 (BPSK) or +-1/sqrt(2) (QPSK, one bit on
+ * I and one on Q), the noise n of variance noise_variance / 2 per dimension and
+ * the LLR scaling 4 s / noise_variance of the Demapper with OPTIMAL_CRF. This
+ * module computes the LLRs directly from the code bits, without complex symbol
+ * buffers.
+ *
+ * The quantization is done by an internal Converter_Float_Fixpoint with
+ * bw_output and bw_output_fract, so scaling, rounding and saturation are
+ * those of the converter. The noise of frame f is the substream
+ * (start_seed, f) of a Counter_Random_Generator with the layout of
+ * Channel_AWGN_IS: with the same seed and frame index both channels add the
+ * same noise. Set_Frame_Index() selects the frame index of the next frame.
+ *
+ * With all_zero the code bits are not read, each frame is the all-zero code
+ * word of num_bits bits (or of the length of input_bits if num_bits is 0).
+ * The noise is the same as for an all-zero input_bits, so both ways give the
+ * same channel values, but the source and the encoder do not need to run.
+ * For a symmetric channel and decoder the error rates of the all-zero code
+ * word are those of random code words.
+ *
+ * \ingroup modules
+ */
+class Channel_AWGN_LLR : public Channel_AWGN_LLR_Interface,
+                         public Channel_AWGN_LLR_Parameter
+{
+
+public:
+
+	Channel_AWGN_LLR() : frame_index_(0) { }
+
+	virtual ~Channel_AWGN_LLR() { }
+
+	int Run();
+
+	/// Select the noise substream of the next frame.
+	void Set_Frame_Index(ull_int frame_index) { frame_index_ = frame_index; }
+
+	/// Frame index of the next frame.
+	ull_int Frame_Index() const { return frame_index_; }
+
+private:
+
+	void Init();
+
+	/// Number of code bits of a frame
+	unsigned int Frame_Length();
+
+	// Random generator of the noise
+	Counter_Random_Generator rand_gen_;
+
+	// Substream of the next frame
+	ull_int frame_index_;
+
+	// Unit variance noise of a frame, I and Q of each symbol
+	Buffer<float> noise_;
+
+	// Unquantized LLRs of a frame
+	Buffer<float> bits_llr_;
+
+	// Fixpoint conversion of the LLRs
+	Converter_Float_Fixpoint<float, int> converter_;
+
+	// Code bits per symbol, 1 (BPSK) or 2 (QPSK)
+	unsigned int bits_per_symbol_;
+
+	// Symbol amplitude per dimension
+	float amplitude_;
+
+	// Standard deviation of each dimension
+	float std_deviation_;
+
+	// LLR scaling factor of a received value
+	float llr_factor_;
+};
+}
+#endif // CHANNEL_AWGN_LLR_H_
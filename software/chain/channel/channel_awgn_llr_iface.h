@@ -0,0 +1,47 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Interface of the fused AWGN channel with LLR output
+/// \date   2026/10/19
+//
+
+#ifndef CHANNEL_AWGN_LLR_IFACE_H_
+#define CHANNEL_AWGN_LLR_IFACE_H_
+
+#include "../modules/base/base_iface.h"
+#include "../assistance/buffer_packed.h"
+
+
+namespace cse_lib {
+
+/// Interface of the fused AWGN channel with LLR output
+/**
+ * \ingroup interface
+ */
+class Channel_AWGN_LLR_Interface : public Base_Interface
+{
+
+public:
+
+	Channel_AWGN_LLR_Interface()
+	{
+		input_bits.Register("input_bits", input_data_list_);
+		input_bits_packed.Register("input_bits_packed", input_data_list_);
+		output_bits_llr.Register("output_bits_llr", output_data_list_);
+	}
+
+	virtual ~Channel_AWGN_LLR_Interface() {}
+
+	/// Code bits
+	Data_In<unsigned int> input_bits;
+
+	/// Code bits packed into 64 bit words, replaces input_bits if connected
+	Data_In<packed_bit> input_bits_packed;
+
+	/// Quantized LLR values of the code bits
+	Data_Out<int> output_bits_llr;
+};
+}
+#endif // CHANNEL_AWGN_LLR_IFACE_H_
@@ -0,0 +1,109 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Parameters of the fused AWGN channel with LLR output
+/// \date   2026/10/19
+//
+
+#ifndef CHANNEL_AWGN_LLR_PARAM_H_
+#define CHANNEL_AWGN_LLR_PARAM_H_
+
+#include "cse_lib.h"
+
+
+namespace cse_lib {
+
+/// Parameter class of the fused AWGN channel with LLR output
+/**
+ * \ingroup parameter
+ */
+class Channel_AWGN_LLR_Parameter : public Base_Parameter
+{
+
+public:
+
+	Channel_AWGN_LLR_Parameter()
+	{
+		instance_name(Unique_ID());
+		Set_Default_Values();
+	}
+
+	virtual ~Channel_AWGN_LLR_Parameter(){}
+
+	/// Unique identification string of the module.
+	static std::string Unique_ID(){ return "Channel_AWGN_LLR";}
+
+
+	/**************
+	 * Parameters *
+	 **************/
+
+	/// Modulation scheme, only MAP_BPSK and MAP_QPSK are supported
+	Param<Mapper_Share::MAPPINGS_ENUM> mapping;
+
+	/// Start seed of the noise generator
+	Param<unsigned int> start_seed;
+
+	/// Variance of the channel. The variance is separated to the two dimensions (I and Q).
+	/**
+	 * The same variance is used for the LLR calculation, like the Demapper
+	 * with channel_reliability OPTIMAL_CRF.
+	 */
+	Param<float> noise_variance;
+
+	/// Bits for representing the output value, see Converter_Float_Fixpoint
+	Param<unsigned int> bw_output;
+
+	/// Number of fractional bits of output value, see Converter_Float_Fixpoint
+	Param<unsigned int> bw_output_fract;
+
+	/// All-zero code word mode
+	/**
+	 * If true, input_bits is not read, every code bit is zero and the channel
+	 * emits the noisy constant symbol. The decoder's hard decisions can be
+	 * checked against the all-zero code word directly, see
+	 * Statistics_Error_Rates_Fast::Zero_Reference().
+	 */
+	Param<bool> all_zero;
+
+	/// Number of code bits per frame in the all-zero mode (0: length of input_bits)
+	Param<unsigned int> num_bits;
+
+
+protected:
+
+
+	/******************
+	 * Default values *
+	 ******************/
+
+	/// Set all parameters to their default values.
+	/**
+	 * Default values:
+	 *  - mapping         : MAP_BPSK
+	 *  - start_seed      : 12424
+	 *  - noise_variance  : 1.0
+	 *  - bw_output       : 6
+	 *  - bw_output_fract : 2
+	 *  - all_zero        : false
+	 *  - num_bits        : 0
+	 */
+	void Set_Default_Values()
+	{
+		mapping.Init(Mapper_Share::MAP_BPSK, "mapping", param_list_);
+		start_seed.Init(12424, "start_seed", param_list_);
+		noise_variance.Init(1.0, "noise_variance", param_list_);
+		bw_output.Init(6, "bw_output", param_list_);
+		bw_output_fract.Init(2, "bw_output_fract", param_list_);
+		all_zero.Init(false, "all_zero", param_list_);
+		num_bits.Init(0, "num_bits", param_list_);
+
+		// Link enum types to strings
+		mapping.Link_Value_String(Mapper_Share::Mapping_Enum_Str());
+	}
+
+};
+}
+#endif // CHANNEL_AWGN_LLR_PARAM_H_
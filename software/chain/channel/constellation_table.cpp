@@ -0,0 +1,194 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Native constellation and soft bit tables of the Mapper_Share mappings
+/// \date   2026/10/19
+//
+
+#include <cmath>
+#include <map>
+#include <vector>
+#include <pthread.h>
+
+#include "constellation_table.h"
+
+using namespace std;
+
+namespace cse_lib {
+
+namespace {
+
+/// Mapping and radius ratios of a table
+typedef pair<int, pair<float, float> > Table_Key;
+
+/// Owner of all tables built by Constellation_Table::Get()
+struct Table_Cache
+{
+	map<Table_Key, Constellation_Table*> tables;
+
+	~Table_Cache()
+	{
+		for (map<Table_Key, Constellation_Table*>::iterator it = tables.begin(); it != tables.end(); ++it)
+			delete it->second;
+	}
+};
+
+Table_Cache table_cache;
+
+/// Serializes the lookup and the construction of tables, chains in several threads share the cache.
+pthread_mutex_t table_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/// Holds table_mutex while in scope, also if the construction of a table throws.
+struct Table_Lock
+{
+	Table_Lock()  { pthread_mutex_lock(&table_mutex); }
+	~Table_Lock() { pthread_mutex_unlock(&table_mutex); }
+};
+}
+
+
+const Constellation_Table& Constellation_Table::Get(Mapper_Share::MAPPINGS_ENUM mapping,
+                                                    float psk_radius_ratio_r2,
+                                                    float psk_radius_ratio_r3)
+{
+	// The radius ratios only matter for APSK.
+	if (mapping != MAP_16_APSK && mapping != MAP_32_APSK)
+		psk_radius_ratio_r2 = 0.0f;
+	if (mapping != MAP_32_APSK)
+		psk_radius_ratio_r3 = 0.0f;
+
+	Table_Key key(mapping, make_pair(psk_radius_ratio_r2, psk_radius_ratio_r3));
+	Table_Lock lock;
+	map<Table_Key, Constellation_Table*>::iterator it = table_cache.tables.find(key);
+
+	if (it != table_cache.tables.end())
+		return *it->second;
+
+	Constellation_Table *table = new Constellation_Table(mapping, psk_radius_ratio_r2, psk_radius_ratio_r3);
+	table_cache.tables[key] = table;
+
+	return *table;
+}
+
+
+Constellation_Table::Constellation_Table(Mapper_Share::MAPPINGS_ENUM mapping,
+                                         float psk_radius_ratio_r2, float psk_radius_ratio_r3)
+{
+	const unsigned int align = 8;    // floats per 32 bytes
+
+	bits_per_symbol_ = Get_Bits_Per_Symbol(mapping);
+	Get_Mapping_LUT(mapping, psk_radius_ratio_r2, psk_radius_ratio_r3);
+	num_points_ = map_lut_.length();
+
+	// Both arrays start at a 32 byte boundary.
+	unsigned int stride = (num_points_ + align - 1) / align * align;
+	point_mem_.Resize(2 * stride + align);
+	point_mem_.Clear();
+
+	size_t offset = (reinterpret_cast<size_t>(&point_mem_[0]) / sizeof(float)) % align;
+	point_real_ = &point_mem_[0] + (offset == 0 ? 0 : align - offset);
+	point_imag_ = point_real_ + stride;
+
+	for (unsigned int a = 0; a < num_points_; a++)
+	{
+		point_real_[a] = map_lut_[a].real();
+		point_imag_[a] = map_lut_[a].imag();
+	}
+
+	// Equivalent of S0 and S1: the points with bit k equal to 0, then the ones equal to 1.
+	unsigned int half = num_points_ / 2;
+	soft_bits_.Resize(2 * bits_per_symbol_ * half);
+
+	for (unsigned int k = 0; k < bits_per_symbol_; k++)
+	{
+		unsigned int count[2] = {0, 0};
+
+		for (unsigned int a = 0; a < num_points_; a++)
+		{
+			unsigned int value = (a >> (bits_per_symbol_ - 1 - k)) & 1;
+			soft_bits_[(2 * k + value) * half + count[value]++] = a;
+		}
+	}
+
+	Init_Levels();
+}
+
+
+void Constellation_Table::Init_Levels()
+{
+	const float eps = 1e-5f;
+	Buffer<unsigned int> level_of_point[2];
+
+	for (unsigned int d = 0; d < 2; d++)
+	{
+		const float *values = (d == 0) ? point_real_ : point_imag_;
+		vector<float> levels;
+		level_of_point[d].Resize(num_points_);
+
+		// Distinct values of the component
+		for (unsigned int a = 0; a < num_points_; a++)
+		{
+			unsigned int l = 0;
+
+			while (l < levels.size() && fabs(levels[l] - values[a]) > eps)
+				l++;
+			if (l == levels.size())
+				levels.push_back(values[a]);
+			level_of_point[d][a] = l;
+		}
+
+		levels_[d].Resize(levels.size());
+		labels_[d].Resize(levels.size());
+		labels_[d].Clear();
+		for (unsigned int l = 0; l < levels.size(); l++)
+			levels_[d][l] = levels[l];
+	}
+
+	separable_ = (levels_[0].length() * levels_[1].length() == num_points_);
+	vector<unsigned int> bits_of_dim[2];
+
+	// Symbol bit j is a bit of component d if it is the same for all points on a level of d.
+	for (unsigned int j = 0; j < bits_per_symbol_ && separable_; j++)
+	{
+		unsigned int shift = bits_per_symbol_ - 1 - j;
+		bool found = false;
+
+		for (unsigned int d = 0; d < 2 && !found; d++)
+		{
+			Buffer<int> value(levels_[d].length());
+			value.Clear();
+
+			found = true;
+			for (unsigned int a = 0; a < num_points_ && found; a++)
+			{
+				int bit = ((a >> shift) & 1) + 1;
+				int &v = value[level_of_point[d][a]];
+
+				if (v == 0)
+					v = bit;
+				else if (v != bit)
+					found = false;
+			}
+
+			if (found)
+			{
+				bits_of_dim[d].push_back(j);
+				for (unsigned int l = 0; l < levels_[d].length(); l++)
+					if (value[l] == 2)
+						labels_[d][l] |= 1u << j;
+			}
+		}
+
+		separable_ = found;
+	}
+
+	for (unsigned int d = 0; d < 2; d++)
+	{
+		bits_of_dim_[d].Resize(separable_ ? bits_of_dim[d].size() : 0);
+		for (unsigned int k = 0; k < bits_of_dim_[d].length(); k++)
+			bits_of_dim_[d][k] = bits_of_dim[d][k];
+	}
+}
+}
@@ -0,0 +1,109 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Native constellation and soft bit tables of the Mapper_Share mappings
+/// \date   2026/10/19
+//
+
+#ifndef CONSTELLATION_TABLE_H_
+#define CONSTELLATION_TABLE_H_
+
+#include "cse_lib.h"
+
+
+namespace cse_lib {
+
+/// Constellation points and soft bit tables of a mapping in plain contiguous arrays
+/**
+ * The table holds the points of a mapping of Mapper_Share in LUT address
+ * order (the MSB of the address is the first bit of a symbol), as separate
+ * arrays of the real and the imaginary parts, aligned to 32 bytes for vector
+ * loads. Points_With_Bit(k, b) lists the points whose bit k equals b, like
+ * the rows of the IT++ matrices S0 and S1 of Mapper_Share, but as plain
+ * arrays of indices.
+ *
+ * If every bit depends either on the real or on the imaginary part only
+ * (BPSK, QPSK, square QAM including the ITPP style ones), Separable() is
+ * true and Levels(), Labels() and Bits_Of_Dim() describe the mapping per
+ * component (d = 0: real part, d = 1: imaginary part).
+ *
+ * Tables are obtained by Get(), which builds the table of a mapping once per
+ * process from the mapping LUT of Mapper_Share and returns the same read-only
+ * table afterwards. The IT++ based construction of the ITPP style mappings
+ * therefore runs only once, modules that use the table do not hold IT++
+ * objects and need no IT++ allocations per frame. Get() is thread safe, the
+ * lookup and the construction run under a mutex. Once created, a table is
+ * never modified, so chains in parallel threads can share it.
+ */
+class Constellation_Table : private Mapper_Share
+{
+
+public:
+
+	/// The table of a mapping, built on first use.
+	static const Constellation_Table& Get(Mapper_Share::MAPPINGS_ENUM mapping,
+	                                      float psk_radius_ratio_r2 = 2.5f,
+	                                      float psk_radius_ratio_r3 = 4.5f);
+
+	/// Number of bits per symbol
+	unsigned int bits_per_symbol() const { return bits_per_symbol_; }
+
+	/// Number of constellation points
+	unsigned int num_points() const { return num_points_; }
+
+	/// Real parts of the points (32 byte aligned)
+	const float* Point_Real() const { return point_real_; }
+
+	/// Imaginary parts of the points (32 byte aligned)
+	const float* Point_Imag() const { return point_imag_; }
+
+	/// Indices of the num_points() / 2 points whose bit k (0: first bit) is equal to value.
+	const unsigned int* Points_With_Bit(unsigned int k, unsigned int value) const
+	{
+		return &soft_bits_[(2 * k + value) * (num_points_ / 2)];
+	}
+
+	/// Does each bit depend either on the real or on the imaginary part only?
+	bool Separable() const { return separable_; }
+
+	/// Amplitude levels of component d (only if Separable())
+	const Buffer<float>& Levels(unsigned int d) const { return levels_[d]; }
+
+	/// Labels of the levels of component d, bit k is the value of symbol bit k (only if Separable())
+	const Buffer<unsigned int>& Labels(unsigned int d) const { return labels_[d]; }
+
+	/// Symbol bits of component d in the order of the symbol (only if Separable())
+	const Buffer<unsigned int>& Bits_Of_Dim(unsigned int d) const { return bits_of_dim_[d]; }
+
+private:
+
+	Constellation_Table(Mapper_Share::MAPPINGS_ENUM mapping,
+	                    float psk_radius_ratio_r2, float psk_radius_ratio_r3);
+
+	// Tables are shared, not copied.
+	Constellation_Table(const Constellation_Table&);
+	Constellation_Table& operator=(const Constellation_Table&);
+
+	/// Split the points into levels of the real and the imaginary part.
+	void Init_Levels();
+
+	unsigned int bits_per_symbol_;
+	unsigned int num_points_;
+
+	// Memory of point_real_ and point_imag_, with room for the alignment
+	Buffer<float> point_mem_;
+	float *point_real_;
+	float *point_imag_;
+
+	// Points_With_Bit() of all bits and values
+	Buffer<unsigned int> soft_bits_;
+
+	bool separable_;
+	Buffer<float> levels_[2];
+	Buffer<unsigned int> labels_[2];
+	Buffer<unsigned int> bits_of_dim_[2];
+};
+}
+#endif // CONSTELLATION_TABLE_H_
@@ -0,0 +1,183 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Vectorized max-log demapper for BPSK, QPSK and square QAM
+/// \date   2026/10/19
+//
+
+#include <cmath>
+#include <cfloat>
+
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
+
+#include "demapper_max_log.h"
+
+using namespace hlp_fct::logging;
+using namespace std;
+
+namespace cse_lib {
+
+void Demapper_Max_Log::Init()
+{
+	unsigned int num_symbols = input_symb().length();
+
+	table_ = &Constellation_Table::Get(mapping());
+	bits_per_symbol_ = table_->bits_per_symbol();
+
+	if (!table_->Separable())
+	{
+		Msg(ERROR, instance_name(), "The bits of this mapping do not separate into I and Q bits!");
+		throw invalid_argument("\nException[Demapper_Max_Log]: unsupported mapping!");
+	}
+
+	llr_factor_ = 1.0f / noise_variance();
+
+	try
+	{
+		output_bits_llr().Resize(num_symbols * bits_per_symbol_);
+		output_bits_llr_fixp().Resize(fixpoint_output() ? num_symbols * bits_per_symbol_ : 0);
+		dist_.Resize(max(table_->Levels(0).length(), table_->Levels(1).length()) * BLOCK_SIZE);
+		block_llr_.Resize(bits_per_symbol_ * BLOCK_SIZE);
+	}
+	catch(bad_alloc&)
+	{
+		Msg(ERROR, instance_name(), "Memory allocation failure!");
+		throw;
+	}
+
+	fixp_factor_ = static_cast<float>(1 << bw_output_fract());
+	fixp_max_magnitude_ = (1 << (bw_output() - 1)) - 1;
+
+	param_list_.config_modified(false);
+	input_data_list_.port_modified(false);
+}
+
+
+void Demapper_Max_Log::Demap_Block(const float *y, unsigned int dim, float *llr)
+{
+	const Buffer<float> &levels = table_->Levels(dim);
+	const Buffer<unsigned int> &labels = table_->Labels(dim);
+	const Buffer<unsigned int> &bits_of_dim = table_->Bits_Of_Dim(dim);
+	unsigned int num_levels = levels.length();
+	float *dist = &dist_[0];
+
+#ifdef __AVX__
+	__m256 y_vec = _mm256_loadu_ps(y);
+
+	// Squared distances to all levels, eight symbols per instruction.
+	for (unsigned int l = 0; l < num_levels; l++)
+	{
+		__m256 diff = _mm256_sub_ps(y_vec, _mm256_set1_ps(levels[l]));
+		_mm256_storeu_ps(dist + l * BLOCK_SIZE, _mm256_mul_ps(diff, diff));
+	}
+
+	for (unsigned int k = 0; k < bits_of_dim.length(); k++)
+	{
+		unsigned int mask = 1u << bits_of_dim[k];
+		__m256 min_0 = _mm256_set1_ps(FLT_MAX);
+		__m256 min_1 = _mm256_set1_ps(FLT_MAX);
+
+		for (unsigned int l = 0; l < num_levels; l++)
+		{
+			__m256 d = _mm256_loadu_ps(dist + l * BLOCK_SIZE);
+
+			if (labels[l] & mask)
+				min_1 = _mm256_min_ps(min_1, d);
+			else
+				min_0 = _mm256_min_ps(min_0, d);
+		}
+
+		_mm256_storeu_ps(llr + k * BLOCK_SIZE,
+		                 _mm256_mul_ps(_mm256_sub_ps(min_1, min_0), _mm256_set1_ps(llr_factor_)));
+	}
+#else
+	for (unsigned int l = 0; l < num_levels; l++)
+		for (unsigned int i = 0; i < BLOCK_SIZE; i++)
+		{
+			float diff = y[i] - levels[l];
+			dist[l * BLOCK_SIZE + i] = diff * diff;
+		}
+
+	for (unsigned int k = 0; k < bits_of_dim.length(); k++)
+	{
+		unsigned int mask = 1u << bits_of_dim[k];
+		float min_0[BLOCK_SIZE];
+		float min_1[BLOCK_SIZE];
+
+		for (unsigned int i = 0; i < BLOCK_SIZE; i++)
+			min_0[i] = min_1[i] = FLT_MAX;
+
+		for (unsigned int l = 0; l < num_levels; l++)
+		{
+			float *m = (labels[l] & mask) ? min_1 : min_0;
+
+			for (unsigned int i = 0; i < BLOCK_SIZE; i++)
+				m[i] = min(m[i], dist[l * BLOCK_SIZE + i]);
+		}
+
+		for (unsigned int i = 0; i < BLOCK_SIZE; i++)
+			llr[k * BLOCK_SIZE + i] = (min_1[i] - min_0[i]) * llr_factor_;
+	}
+#endif
+}
+
+
+int Demapper_Max_Log::Run()
+{
+	if (param_list_.config_modified() || input_data_list_.port_modified() ||
+	    output_bits_llr().length() != input_symb().length() * bits_per_symbol_)
+		Init();
+
+	Buffer<complex<float> > &symb = input_symb();
+	Buffer<float> &bits_llr = output_bits_llr();
+	Buffer<int> &bits_llr_fixp = output_bits_llr_fixp();
+	bool fixpoint = fixpoint_output();
+	unsigned int num_symbols = symb.length();
+
+	for (unsigned int i = 0; i < num_symbols; i += BLOCK_SIZE)
+	{
+		unsigned int num_valid = min<unsigned int>(BLOCK_SIZE, num_symbols - i);
+
+		// I and Q of the block, the lanes beyond the last symbol are ignored.
+		for (unsigned int s = 0; s < BLOCK_SIZE; s++)
+		{
+			complex<float> y = (s < num_valid) ? symb[i + s] : complex<float>(0.0f, 0.0f);
+			block_[0][s] = y.real();
+			block_[1][s] = y.imag();
+		}
+
+		for (unsigned int d = 0; d < 2; d++)
+		{
+			const Buffer<unsigned int> &bits_of_dim = table_->Bits_Of_Dim(d);
+
+			if (bits_of_dim.length() == 0)
+				continue;
+
+			Demap_Block(block_[d], d, &block_llr_[0]);
+
+			// Scatter the LLRs to their bits and quantize them on the way.
+			for (unsigned int k = 0; k < bits_of_dim.length(); k++)
+				for (unsigned int s = 0; s < num_valid; s++)
+				{
+					unsigned int pos = (i + s) * bits_per_symbol_ + bits_of_dim[k];
+					float llr = block_llr_[k * BLOCK_SIZE + s];
+
+					bits_llr[pos] = llr;
+
+					if (fixpoint)
+					{
+						int value = static_cast<int>(floor(llr * fixp_factor_ + 0.5f));
+						Saturate_Value(value, fixp_max_magnitude_);
+						bits_llr_fixp[pos] = value;
+					}
+				}
+		}
+	}
+
+	return 0;
+}
+}
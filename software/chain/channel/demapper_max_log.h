@@ -0,0 +1,93 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Vectorized max-log demapper for BPSK, QPSK and square QAM
+/// \date   2026/10/19
+//
+
+#ifndef DEMAPPER_MAX_LOG_H_
+#define DEMAPPER_MAX_LOG_H_
+
+#include "demapper_max_log_iface.h"
+#include "demapper_max_log_param.h"
+#include "constellation_table.h"
+
+
+namespace cse_lib {
+
+/// Max-log demapper for mappings with separate I and Q bits, eight symbols at a time
+/**
+ * For BPSK, QPSK and the square QAM mappings of Mapper_Share every bit of a
+ * symbol depends either on the I or on the Q component only. The max-log LLR
+ * of a bit is then a function of one component y:
+ *
+ * LLR = (min_{a: bit = 1} (y - a)^2 - min_{a: bit = 0} (y - a)^2) / noise_variance,
+ *
+ * with a running over the amplitude levels of that component, i.e., the
+ * piecewise linear max-log LLR of the Gray labeled PAM. No exp() or log() is
+ * evaluated and the other component cancels out. The levels and the labeling
+ * are taken from the shared Constellation_Table of the mapping at Init(), so
+ * the LLRs belong to exactly the symbols of the Mapper, and the module holds
+ * no IT++ objects. Mappings without separate I and Q bits (8-PSK, APSK) are
+ * rejected.
+ *
+ * The distances are computed for eight symbols per instruction with AVX (if
+ * the -mavx or -mavx2 flag is set), otherwise by the equivalent scalar loops.
+ *
+ * With fixpoint_output the LLRs are additionally quantized with bw_output and
+ * bw_output_fract while they are written to output_bits_llr, with the rounding
+ * and saturation of Converter_Float_Fixpoint, so this module replaces
+ * Demapper and Converter_Float_Fixpoint in a chain.
+ *
+ * \ingroup modules
+ */
+class Demapper_Max_Log : public Demapper_Max_Log_Interface,
+                         public Demapper_Max_Log_Parameter
+{
+
+public:
+
+	Demapper_Max_Log() : table_(NULL), bits_per_symbol_(0) { }
+
+	virtual ~Demapper_Max_Log() { }
+
+	int Run();
+
+private:
+
+	void Init();
+
+	/// LLRs of the bits of one component of eight symbols.
+	void Demap_Block(const float *y, unsigned int dim, float *llr);
+
+	/// Number of lanes of Demap_Block()
+	enum { BLOCK_SIZE = 8 };
+
+	// Levels and labels of the I and the Q component
+	const Constellation_Table *table_;
+
+	// Code bits per symbol
+	unsigned int bits_per_symbol_;
+
+	// Components of a block of symbols, I and Q
+	float block_[2][BLOCK_SIZE];
+
+	// Squared distances of a block of symbols to the levels of one component
+	Buffer<float> dist_;
+
+	// LLRs of the bits of one component of a block of symbols
+	Buffer<float> block_llr_;
+
+	// LLR scaling, 1 / noise_variance
+	float llr_factor_;
+
+	// Scaling of the LLRs for the fixpoint output, 2^bw_output_fract
+	float fixp_factor_;
+
+	// Maximum magnitude of the fixpoint output
+	unsigned int fixp_max_magnitude_;
+};
+}
+#endif // DEMAPPER_MAX_LOG_H_
@@ -0,0 +1,47 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Interface of the vectorized max-log demapper
+/// \date   2026/10/19
+//
+
+#ifndef DEMAPPER_MAX_LOG_IFACE_H_
+#define DEMAPPER_MAX_LOG_IFACE_H_
+
+#include <complex>
+#include "../modules/base/base_iface.h"
+
+
+namespace cse_lib {
+
+/// Interface of the vectorized max-log demapper
+/**
+ * \ingroup interface
+ */
+class Demapper_Max_Log_Interface : public Base_Interface
+{
+
+public:
+
+	Demapper_Max_Log_Interface()
+	{
+		input_symb.Register("input_symb", input_data_list_);
+		output_bits_llr.Register("output_bits_llr", output_data_list_);
+		output_bits_llr_fixp.Register("output_bits_llr_fixp", output_data_list_);
+	}
+
+	virtual ~Demapper_Max_Log_Interface() {}
+
+	/// Received symbols
+	Data_In<complex<float> > input_symb;
+
+	/// LLR values of the demapped bits
+	Data_Out<float> output_bits_llr;
+
+	/// Quantized LLR values of the demapped bits (only with fixpoint_output)
+	Data_Out<int> output_bits_llr_fixp;
+};
+}
+#endif // DEMAPPER_MAX_LOG_IFACE_H_
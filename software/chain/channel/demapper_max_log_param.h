@@ -0,0 +1,89 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Parameters of the vectorized max-log demapper
+/// \date   2026/10/19
+//
+
+#ifndef DEMAPPER_MAX_LOG_PARAM_H_
+#define DEMAPPER_MAX_LOG_PARAM_H_
+
+#include "cse_lib.h"
+
+
+namespace cse_lib {
+
+/// Parameter class of the vectorized max-log demapper
+/**
+ * \ingroup parameter
+ */
+class Demapper_Max_Log_Parameter : public Base_Parameter
+{
+
+public:
+
+	Demapper_Max_Log_Parameter()
+	{
+		instance_name(Unique_ID());
+		Set_Default_Values();
+	}
+
+	virtual ~Demapper_Max_Log_Parameter(){}
+
+	/// Unique identification string of the module.
+	static std::string Unique_ID(){ return "Demapper_Max_Log";}
+
+
+	/**************
+	 * Parameters *
+	 **************/
+
+	/// Modulation scheme, only mappings with separate I and Q bits (BPSK, QPSK, QAM)
+	Param<Mapper_Share::MAPPINGS_ENUM> mapping;
+
+	/// Noise variance used for demapping, this is the overall variance (imaginary and real part)
+	Param<float> noise_variance;
+
+	/// Quantize the LLRs to output_bits_llr_fixp, see Converter_Float_Fixpoint
+	Param<bool> fixpoint_output;
+
+	/// Bits for representing the output value, see Converter_Float_Fixpoint
+	Param<unsigned int> bw_output;
+
+	/// Number of fractional bits of output value, see Converter_Float_Fixpoint
+	Param<unsigned int> bw_output_fract;
+
+
+protected:
+
+
+	/******************
+	 * Default values *
+	 ******************/
+
+	/// Set all parameters to their default values.
+	/**
+	 * Default values:
+	 *  - mapping         : MAP_BPSK
+	 *  - noise_variance  : 1.0
+	 *  - fixpoint_output : true
+	 *  - bw_output       : 6
+	 *  - bw_output_fract : 2
+	 */
+	void Set_Default_Values()
+	{
+		mapping.Init(Mapper_Share::MAP_BPSK, "mapping", param_list_);
+		noise_variance.Init(1.0, "noise_variance", param_list_);
+		fixpoint_output.Init(true, "fixpoint_output", param_list_);
+		bw_output.Init(6, "bw_output", param_list_);
+		bw_output_fract.Init(2, "bw_output_fract", param_list_);
+
+		// Link enum types to strings
+		mapping.Link_Value_String(Mapper_Share::Mapping_Enum_Str());
+	}
+
+};
+}
+#endif // DEMAPPER_MAX_LOG_PARAM_H_
@@ -0,0 +1,261 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Capture of decoding failures for offline replay
+/// \date   2026/10/19
+//
+
+#include <cstring>
+#include <climits>
+
+#include "dec_failure_capture.h"
+
+using namespace hlp_fct::logging;
+using namespace std;
+
+namespace cse_lib {
+
+/// File magic and version of the capture format, see Decoder_Failure_Capture.
+static const char capture_magic[8] = { 'L', 'D', 'P', 'C', 'F', 'R', 'M', '1' };
+static const unsigned int capture_version = 1;
+
+
+/// Write values to a capture file.
+template <class T>
+static void Capture_Put(std::FILE *file, const T *values, unsigned int length)
+{
+	if (length > 0 && fwrite(values, sizeof(T), length, file) != length)
+		throw runtime_error("\nException[Decoder_Failure_Capture]: Writing the capture file failed!");
+}
+
+
+/// Read values from a capture file.
+template <class T>
+static void Capture_Get(std::FILE *file, T *values, unsigned int length)
+{
+	if (length > 0 && fread(values, sizeof(T), length, file) != length)
+		throw runtime_error("\nException[Decoder_Failure_Reader]: Capture record is incomplete!");
+}
+
+
+/// Pack a bit buffer LSB first into bytes.
+static void Pack_Bits(const u_int *bits, unsigned int num_bits, Buffer<unsigned char> &packed)
+{
+	packed.Resize((num_bits + 7) / 8);
+	packed.Clear();
+	for (unsigned int i = 0; i < num_bits; i++)
+		if (bits[i] != 0)
+			packed[i / 8] |= 1 << (i % 8);
+}
+
+
+/// Unpack bytes into a bit buffer, see Pack_Bits().
+static void Unpack_Bits(const Buffer<unsigned char> &packed, unsigned int num_bits, Buffer<u_int> &bits)
+{
+	bits.Resize(num_bits);
+	for (unsigned int i = 0; i < num_bits; i++)
+		bits[i] = (packed[i / 8] >> (i % 8)) & 1;
+}
+
+
+Decoder_Failure_Capture::Decoder_Failure_Capture()
+	: file_(NULL), num_points_(0), frames_(0), captured_frames_(0),
+	  source_seed_(0), channel_seed_(0), noise_variance_(0.0f)
+{
+}
+
+
+void Decoder_Failure_Capture::Begin_Point(unsigned int source_seed, unsigned int channel_seed,
+                                          float noise_variance)
+{
+	num_points_++;
+	frames_          = 0;
+	captured_frames_ = 0;
+	source_seed_     = source_seed;
+	channel_seed_    = channel_seed;
+	noise_variance_  = noise_variance;
+
+	num_total_blocks().Write(0);
+	num_captured_blocks().Write(0);
+}
+
+
+void Decoder_Failure_Capture::Close()
+{
+	if (file_ != NULL)
+		fclose(file_);
+
+	file_ = NULL;
+	open_file_name_.clear();
+}
+
+
+void Decoder_Failure_Capture::Init()
+{
+	// All simulation points go into the same file, reopen only if the name changes.
+	if (file_ == NULL || open_file_name_ != file_name())
+	{
+		Close();
+
+		file_ = fopen(file_name().c_str(), "wb");
+		if (file_ == NULL)
+		{
+			Msg(ERROR, instance_name(), "Cannot write capture file " + file_name() + "!");
+			throw runtime_error("\nException[Decoder_Failure_Capture]: Cannot open capture file " + file_name() + "!");
+		}
+		open_file_name_ = file_name();
+
+		try
+		{
+			Capture_Put(file_, capture_magic, sizeof(capture_magic));
+			Capture_Put(file_, &capture_version, 1);
+		}
+		catch(runtime_error&)
+		{
+			Msg(ERROR, instance_name(), "Cannot write capture file " + file_name() + "!");
+			throw;
+		}
+	}
+
+	param_list_.config_modified(false);
+	input_data_list_.port_modified(false);
+}
+
+
+int Decoder_Failure_Capture::Run()
+{
+	Buffer<u_int, 2> &bits = input_bits();
+	Buffer<u_int> &ref = input_bits_ref();
+	unsigned int num_bit_errors = 0;
+
+	if (param_list_.config_modified() || file_ == NULL)
+		Init();
+
+	if (bits.dim1() == 0 || ref.length() == 0)
+		return 0;
+
+	unsigned int last_row = bits.dim1() - 1;
+	unsigned int num_bits = min(bits.dim2(), ref.length());
+
+	for (unsigned int i = 0; i < num_bits; i++)
+		if (bits[last_row][i] != ref[i])
+			num_bit_errors++;
+
+	if (num_bit_errors > 0 &&
+	    (max_num_frames() == 0 || captured_frames_ < max_num_frames()))
+	{
+		try
+		{
+			Write_Record(num_bits, num_bit_errors);
+		}
+		catch(runtime_error&)
+		{
+			Msg(ERROR, instance_name(), "Cannot write capture file " + file_name() + "!");
+			throw;
+		}
+		captured_frames_++;
+	}
+
+	frames_++;
+	num_total_blocks().Write(frames_);
+	num_captured_blocks().Write(captured_frames_);
+
+	return 0;
+}
+
+
+void Decoder_Failure_Capture::Write_Record(unsigned int num_bits, unsigned int num_bit_errors)
+{
+	Buffer<int> &llr = input_bits_llr();
+	unsigned int num_llr = llr.length();
+	unsigned int point = (num_points_ > 0) ? num_points_ - 1 : 0;
+
+	Capture_Put(file_, &point, 1);
+	Capture_Put(file_, &frames_, 1);
+	Capture_Put(file_, &source_seed_, 1);
+	Capture_Put(file_, &channel_seed_, 1);
+	Capture_Put(file_, &noise_variance_, 1);
+	Capture_Put(file_, &num_bit_errors, 1);
+	Capture_Put(file_, &num_llr, 1);
+	Capture_Put(file_, &num_bits, 1);
+
+	// The quantized channel values are a few bits wide, 16 bits are plenty.
+	for (unsigned int i = 0; i < num_llr; i++)
+	{
+		short value = static_cast<short>(max(SHRT_MIN, min(SHRT_MAX, llr[i])));
+		Capture_Put(file_, &value, 1);
+	}
+
+	Pack_Bits(&input_bits()[input_bits().dim1() - 1][0], num_bits, packed_bits_);
+	Capture_Put(file_, &packed_bits_[0], packed_bits_.length());
+	Pack_Bits(&input_bits_ref()[0], num_bits, packed_bits_);
+	Capture_Put(file_, &packed_bits_[0], packed_bits_.length());
+
+	fflush(file_);
+}
+
+
+void Decoder_Failure_Reader::Open(const std::string &file_name)
+{
+	char magic[sizeof(capture_magic)];
+	unsigned int version;
+
+	Close();
+
+	file_ = fopen(file_name.c_str(), "rb");
+	if (file_ == NULL)
+		throw runtime_error("\nException[Decoder_Failure_Reader]: Cannot open capture file " + file_name + "!");
+
+	if (fread(magic, sizeof(magic), 1, file_) != 1 ||
+	    memcmp(magic, capture_magic, sizeof(magic)) != 0)
+		throw runtime_error("\nException[Decoder_Failure_Reader]: " + file_name + " is no failure capture!");
+
+	Capture_Get(file_, &version, 1);
+	if (version != capture_version)
+		throw runtime_error("\nException[Decoder_Failure_Reader]: Unsupported capture version!");
+}
+
+
+void Decoder_Failure_Reader::Close()
+{
+	if (file_ != NULL)
+		fclose(file_);
+
+	file_ = NULL;
+}
+
+
+bool Decoder_Failure_Reader::Read(Decoder_Failure_Record &record)
+{
+	unsigned int num_llr;
+	unsigned int num_bits;
+
+	// A clean end of file is only allowed between records.
+	if (fread(&record.point, sizeof(record.point), 1, file_) != 1)
+		return false;
+
+	Capture_Get(file_, &record.frame, 1);
+	Capture_Get(file_, &record.source_seed, 1);
+	Capture_Get(file_, &record.channel_seed, 1);
+	Capture_Get(file_, &record.noise_variance, 1);
+	Capture_Get(file_, &record.num_bit_errors, 1);
+	Capture_Get(file_, &num_llr, 1);
+	Capture_Get(file_, &num_bits, 1);
+
+	llr_.Resize(num_llr);
+	Capture_Get(file_, &llr_[0], num_llr);
+	record.bits_llr.Resize(num_llr);
+	for (unsigned int i = 0; i < num_llr; i++)
+		record.bits_llr[i] = llr_[i];
+
+	packed_bits_.Resize((num_bits + 7) / 8);
+	Capture_Get(file_, &packed_bits_[0], packed_bits_.length());
+	Unpack_Bits(packed_bits_, num_bits, record.bits);
+	Capture_Get(file_, &packed_bits_[0], packed_bits_.length());
+	Unpack_Bits(packed_bits_, num_bits, record.bits_ref);
+
+	return true;
+}
+}
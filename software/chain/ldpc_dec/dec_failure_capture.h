@@ -0,0 +1,138 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Capture of decoding failures for offline replay
+/// \date   2026/10/19
+//
+
+#ifndef DEC_FAILURE_CAPTURE_H_
+#define DEC_FAILURE_CAPTURE_H_
+
+#include <cstdio>
+#include <string>
+
+#include "dec_failure_capture_iface.h"
+#include "dec_failure_capture_param.h"
+
+
+namespace cse_lib {
+
+/// One captured frame, see Decoder_Failure_Capture.
+struct Decoder_Failure_Record
+{
+	unsigned int  point;          ///< Simulation point, counted from 0
+	ull_int       frame;          ///< Frame of the simulation point, counted from 0
+	unsigned int  source_seed;    ///< Start seed of the source of the simulation point
+	unsigned int  channel_seed;   ///< Start seed of the channel of the simulation point
+	float         noise_variance; ///< Noise variance of the channel
+	unsigned int  num_bit_errors; ///< Differences of hard decision and reference
+
+	Buffer<int>   bits_llr;       ///< Quantized channel values
+	Buffer<u_int> bits;           ///< Hard decision of the decoder
+	Buffer<u_int> bits_ref;       ///< Reference code word
+};
+
+
+/// Writes the frames a decoder failed on into a binary capture file.
+/**
+ * Run() is called after the decoder. If the last row of input_bits differs
+ * from input_bits_ref, the frame is appended to the capture file together with
+ * the quantized channel values input_bits_llr, i.e., the output of
+ * Converter_Float_Fixpoint, and the information needed to find the frame in
+ * the simulation again. Successful frames are only counted. At most
+ * max_num_frames frames are captured per simulation point, see Begin_Point().
+ *
+ * Capture format (native int, little endian on x86):
+ *  - header: "LDPCFRM1", version
+ *  - one record per frame: point, frame (64 bit), source_seed, channel_seed,
+ *    noise_variance (float), num_bit_errors, number of channel values,
+ *    number of bits, the channel values as 16 bit integers, the hard decision
+ *    and the reference packed into bytes (bit i in byte i / 8, LSB first)
+ *
+ * A record holds the channel values themselves, so ldpc_failure_replay
+ * decodes a captured frame without any other input. With Channel_AWGN_IS or
+ * Channel_AWGN_LLR the noise of a frame is the substream (channel_seed, frame)
+ * of a Counter_Random_Generator and the chain starts each point at frame 0,
+ * so the noise of a captured frame is regenerated from its index alone with
+ * Set_Frame_Index(), without simulating the frames before it. Use
+ * Decoder_Failure_Reader to read a capture file.
+ *
+ * \ingroup modules
+ */
+class Decoder_Failure_Capture : public Decoder_Failure_Capture_Interface,
+                                public Decoder_Failure_Capture_Parameter
+{
+
+public:
+
+	Decoder_Failure_Capture();
+
+	virtual ~Decoder_Failure_Capture() { Close(); }
+
+	/// Check the decoded frame and capture it on a failure.
+	int Run();
+
+	/// Start a new simulation point.
+	/**
+	 * \param source_seed     Start seed of the source.
+	 * \param channel_seed    Start seed of the channel.
+	 * \param noise_variance  Noise variance of the channel.
+	 */
+	void Begin_Point(unsigned int source_seed, unsigned int channel_seed, float noise_variance);
+
+	/// Close the capture file (if open).
+	void Close();
+
+protected:
+
+	void Init();
+
+private:
+
+	/// Append the current frame to the capture file.
+	void Write_Record(unsigned int num_bits, unsigned int num_bit_errors);
+
+	std::FILE   *file_;
+	std::string  open_file_name_;
+
+	unsigned int  num_points_;
+	ull_int       frames_;
+	ull_int       captured_frames_;
+	unsigned int  source_seed_;
+	unsigned int  channel_seed_;
+	float         noise_variance_;
+
+	Buffer<unsigned char> packed_bits_;
+};
+
+
+/// Reads the records of a capture file written by Decoder_Failure_Capture.
+class Decoder_Failure_Reader
+{
+
+public:
+
+	Decoder_Failure_Reader() : file_(NULL) { }
+
+	virtual ~Decoder_Failure_Reader() { Close(); }
+
+	/// Open a capture file and check its header.
+	void Open(const std::string &file_name);
+
+	/// Close the capture file (if open).
+	void Close();
+
+	/// Read the next record, returns false at the end of the file.
+	bool Read(Decoder_Failure_Record &record);
+
+private:
+
+	std::FILE *file_;
+
+	Buffer<unsigned char> packed_bits_;
+	Buffer<short>         llr_;
+};
+}
+#endif // DEC_FAILURE_CAPTURE_H_
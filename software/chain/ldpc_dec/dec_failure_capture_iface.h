@@ -0,0 +1,55 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Interface of the decoding failure capture
+/// \date   2026/10/19
+//
+
+#ifndef DEC_FAILURE_CAPTURE_IFACE_H_
+#define DEC_FAILURE_CAPTURE_IFACE_H_
+
+#include "../modules/base/base_iface.h"
+
+
+namespace cse_lib {
+
+/// Interface of the decoding failure capture
+/**
+ * \ingroup interface
+ */
+class Decoder_Failure_Capture_Interface : public Base_Interface
+{
+
+public:
+
+	Decoder_Failure_Capture_Interface()
+	{
+		input_bits_llr.Register("input_bits_llr", input_data_list_);
+		input_bits.Register("input_bits", input_data_list_);
+		input_bits_ref.Register("input_bits_ref", input_data_list_);
+
+		num_total_blocks.Register("num_total_blocks", status_out_list_);
+		num_captured_blocks.Register("num_captured_blocks", status_out_list_);
+	}
+
+	virtual ~Decoder_Failure_Capture_Interface() { }
+
+	/// Quantized channel values of the decoder
+	Data_In<int> input_bits_llr;
+
+	/// Hard decision of the decoder, the last row (e.g. the last iteration) is evaluated
+	Data_In<u_int, 2> input_bits;
+
+	/// Reference code word
+	Data_In<u_int> input_bits_ref;
+
+	/// Number of frames of the simulation point
+	Status_Out<ull_int> num_total_blocks;
+
+	/// Number of frames written to the capture file in the simulation point
+	Status_Out<ull_int> num_captured_blocks;
+};
+}
+#endif // DEC_FAILURE_CAPTURE_IFACE_H_
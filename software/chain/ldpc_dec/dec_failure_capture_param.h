@@ -0,0 +1,71 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Parameters of the decoding failure capture
+/// \date   2026/10/19
+//
+
+#ifndef DEC_FAILURE_CAPTURE_PARAM_H_
+#define DEC_FAILURE_CAPTURE_PARAM_H_
+
+#include "cse_lib.h"
+
+
+namespace cse_lib {
+
+/// Parameter class of the decoding failure capture
+/**
+ * \ingroup parameter
+ */
+class Decoder_Failure_Capture_Parameter : public Base_Parameter
+{
+
+public:
+
+	Decoder_Failure_Capture_Parameter()
+	{
+		instance_name(Unique_ID());
+		Set_Default_Values();
+	}
+
+	virtual ~Decoder_Failure_Capture_Parameter(){}
+
+	/// Unique identification string of the module.
+	static std::string Unique_ID(){ return "Decoder_Failure_Capture";}
+
+
+	/**************
+	 * Parameters *
+	 **************/
+
+	/// Binary capture file, an existing file is overwritten, see Decoder_Failure_Capture
+	Param<raw_string> file_name;
+
+	/// Maximum number of frames to capture per simulation point (0: all failures)
+	Param<unsigned int> max_num_frames;
+
+
+protected:
+
+
+	/******************
+	 * Default values *
+	 ******************/
+
+	/// Set all parameters to their default values.
+	/**
+	 * Default values:
+	 *  - file_name      : failures.bin
+	 *  - max_num_frames : 100
+	 */
+	void Set_Default_Values()
+	{
+		file_name.Init("failures.bin", "file_name", param_list_);
+		max_num_frames.Init(100, "max_num_frames", param_list_);
+	}
+
+};
+}
+#endif // DEC_FAILURE_CAPTURE_PARAM_H_
@@ -33,12 +33,29 @@ public:
 		input_bits_llr.Register("input_bits_llr", input_data_list_);
 		output_bits.Register("output_bits", output_data_list_);
 		output_bits_llr_app.Register("output_bits_llr_app", output_data_list_);
+		output_bits_packed.Register("output_bits_packed", output_data_list_);
 
 		mean_iterations.Register("mean_iterations", status_out_list_, true);
 		iterations_performed.Register("iterations_performed", status_out_list_, false);
         flipped_bits.Register("flipped_bits", status_out_list_, true);
 		decoding_successful.Register("decoding_successful", status_out_list_, false);
 		num_modified_systematic_bits.Register("num_modified_systematic_bits", status_out_list_, false);
+
+		unsatisfied_checks.Register("unsatisfied_checks", status_out_list_, true);
+		unsatisfied_checks.dim_name(0, "iteration");
+		split_row_conditions.Register("split_row_conditions", status_out_list_, true);
+		split_row_conditions.dim_name(0, "iteration");
+		split_row_conditions.dim_name(1, "condition");
+		app_saturation.Register("app_saturation", status_out_list_, true);
+		app_saturation.dim_name(0, "iteration");
+
+#ifdef LDPC_PERF_COUNTERS
+		perf_counters.Register("perf_counters", status_out_list_, true);
+		perf_counters.dim_name(0, "phase");
+		perf_counters.dim_name(1, "event");
+		perf_ipc.Register("perf_ipc", status_out_list_, true);
+		perf_ipc.dim_name(0, "phase");
+#endif
 	}
 
 	virtual ~Decoder_LDPC_Binary_HW_Interface() {}
@@ -52,6 +69,9 @@ public:
 	/// LLR values of decoded bits.
 	Data_Out<int, 2>          output_bits_llr_app;
 
+	/// Hard bits after decoding, packed into 64 bit words (see bit_packing).
+	Data_Out<ull_int, 2>      output_bits_packed;
+
 	/// Amount of iterations required for decoding.
 	Status_Out<unsigned int>  iterations_performed;
 
@@ -59,7 +79,7 @@ public:
     Status_Out<unsigned int, 1> flipped_bits;
 
 	/// Mean numer of iterations required for decoding (for each single iteration number).
-	Status_Out<unsigned int, 1, Status_Out_Plugin_Mean> mean_iterations;
+	Status_Out<unsigned int, 1, Status_Out_Plugin_Mean_Sharded> mean_iterations;
 
 	/// All parity checks satisfied?
 	Status_Out<bool>          decoding_successful;
@@ -70,6 +90,32 @@ public:
 	/// Number of parity checks that are not satisfied after decoding.
 	Status_Out<unsigned int>  num_unsatisfied_parity_checks;
 
+	/// Mean number of unsatisfied parity checks after each iteration (for each single iteration number).
+	Status_Out<unsigned int, 1, Status_Out_Plugin_Mean_Sharded> unsatisfied_checks;
+
+	/// Mean number of partitions per frame that took each Split-Row threshold condition in an iteration.
+	/**
+	 * condition: 0 condition 1, 1 condition 2a, 2 condition 2b, 3 condition 3, 4 condition 4
+	 * Only written by the Split-Row algorithms and only for the iterations
+	 * that were actually performed.
+	 */
+	Status_Out<ull_int, 2, Status_Out_Plugin_Mean_Sharded> split_row_conditions;
+
+	/// Histogram of the percentage of saturated APP values after each iteration.
+	Status_Out<unsigned int, 1, Status_Out_Plugin_Histogram_Sharded> app_saturation;
+
+#ifdef LDPC_PERF_COUNTERS
+	/// Hardware performance counters since the last configuration.
+	/**
+	 * phase: 0 gather, 1 check node, 2 scatter
+	 * event: 0 cycles, 1 instructions, 2 cache misses, 3 branch misses
+	 */
+	Status_Out<ull_int, 2>    perf_counters;
+
+	/// Instructions per cycle of each phase since the last configuration.
+	Status_Out<double, 1>     perf_ipc;
+#endif
+
 };
 }
 #endif // DEC_LDPC_BIN_HW_IFACE_H_
@@ -11,6 +11,9 @@
 //
 
 #include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
 #include <assert.h>
 
 #include "dec_ldpc_bin_hw_share.h"
@@ -36,6 +39,436 @@ void Decoder_LDPC_Binary_HW_Share::Change_Shift_Direction()
 }
 
 
+void Decoder_LDPC_Binary_HW_Share::Init_Partition_Tables()
+{
+	unsigned int num_cng = num_check_nodes_ / dst_parallelism_;
+	unsigned int partition_length[num_partitions_];
+	unsigned int map_offset;
+	unsigned int pos;
+
+	if (num_partitions_ == 0)
+		throw invalid_argument("\nException[Decoder_LDPC_Binary_HW_Share]: "
+		                       "At least one partition is required!");
+
+	if (partition_map_.length() != 0 &&
+	    partition_map_.length() != max_check_degree_ &&
+	    partition_map_.length() != num_cng * max_check_degree_)
+		throw invalid_argument("\nException[Decoder_LDPC_Binary_HW_Share]: "
+		                       "partition_map has to contain max_check_degree entries, "
+		                       "or max_check_degree entries for each check node group!");
+
+	for (unsigned int i = 0; i < partition_map_.length(); i++)
+		if (partition_map_[i] >= num_partitions_)
+			throw invalid_argument("\nException[Decoder_LDPC_Binary_HW_Share]: "
+			                       "partition_map refers to a partition >= num_partitions!");
+
+	if (partition_neighbors_.length() % 2 != 0)
+		throw invalid_argument("\nException[Decoder_LDPC_Binary_HW_Share]: "
+		                       "partition_neighbors has to contain pairs of partitions!");
+
+	for (unsigned int i = 0; i < partition_neighbors_.length(); i += 2)
+		if (partition_neighbors_[i]     >= num_partitions_ ||
+		    partition_neighbors_[i + 1] >= num_partitions_ ||
+		    partition_neighbors_[i] == partition_neighbors_[i + 1])
+			throw invalid_argument("\nException[Decoder_LDPC_Binary_HW_Share]: "
+			                       "partition_neighbors contains an invalid pair!");
+
+	/*
+	 * Edges of each check node group, sorted by partition. Within a partition
+	 * the edges keep their order, so that contiguous partitions reproduce
+	 * the processing order of the edges.
+	 */
+	partition_start_.Resize(num_cng * (num_partitions_ + 1));
+	partition_edges_.Resize(num_cng * max_check_degree_);
+
+	for (unsigned int cng = 0; cng < num_cng; cng++)
+	{
+		unsigned int *part_start = &partition_start_[cng * (num_partitions_ + 1)];
+		unsigned int *part_edges = &partition_edges_[cng * max_check_degree_];
+
+		if (partition_map_.length() == 0)
+		{
+			Calculate_Partition_Length(partition_length, cng, num_partitions_);
+
+			pos = 0;
+			for (unsigned int part = 0; part < num_partitions_; part++)
+			{
+				part_start[part] = pos;
+				for (unsigned int i = 0; i < partition_length[part]; i++, pos++)
+					part_edges[pos] = pos;
+			}
+		}
+		else
+		{
+			map_offset = (partition_map_.length() == max_check_degree_) ? 0 : cng * max_check_degree_;
+
+			pos = 0;
+			for (unsigned int part = 0; part < num_partitions_; part++)
+			{
+				part_start[part] = pos;
+				for (unsigned int edge = 0; edge < max_check_degree_; edge++)
+					if (partition_map_[map_offset + edge] == part)
+						part_edges[pos++] = edge;
+			}
+		}
+		part_start[num_partitions_] = pos;
+	}
+
+	// Neighbors of each partition, without neighbor pairs the left and right partition.
+	std::vector< std::vector<unsigned int> > neighbors(num_partitions_);
+
+	if (partition_neighbors_.length() == 0)
+	{
+		for (unsigned int part = 1; part < num_partitions_; part++)
+		{
+			neighbors[part - 1].push_back(part);
+			neighbors[part].push_back(part - 1);
+		}
+	}
+	else
+	{
+		for (unsigned int i = 0; i < partition_neighbors_.length(); i += 2)
+		{
+			unsigned int a = partition_neighbors_[i];
+			unsigned int b = partition_neighbors_[i + 1];
+
+			// Neighbors given twice must not exchange their sign twice.
+			if (find(neighbors[a].begin(), neighbors[a].end(), b) != neighbors[a].end())
+				continue;
+
+			neighbors[a].push_back(b);
+			neighbors[b].push_back(a);
+		}
+	}
+
+	neighbor_start_.Resize(num_partitions_ + 1);
+	neighbor_list_.Resize(2 * max(partition_neighbors_.length(), num_partitions_));
+
+	pos = 0;
+	for (unsigned int part = 0; part < num_partitions_; part++)
+	{
+		neighbor_start_[part] = pos;
+		for (unsigned int i = 0; i < neighbors[part].size(); i++)
+			neighbor_list_[pos++] = neighbors[part][i];
+	}
+	neighbor_start_[num_partitions_] = pos;
+}
+
+
+void Decoder_LDPC_Binary_HW_Share::Init_Esf_Lut()
+{
+	unsigned int num_luts = (esf_schedule_.length() > 0) ? esf_schedule_.length() : 1;
+	unsigned int scaled;
+
+	if (esf_denominator_ == 0 && esf_schedule_.length() > 0)
+		throw invalid_argument("\nException[Decoder_LDPC_Binary_HW_Share]: "
+		                       "esf_schedule requires esf_denominator != 0!");
+
+	/*
+	 * Magnitudes are limited by max_msg_extr_, Split Row may also emit the
+	 * threshold as magnitude.
+	 */
+	esf_lut_size_ = ((threshold_ > max_msg_extr_) ? threshold_ : max_msg_extr_) + 1;
+	esf_lut_.Resize(num_luts * esf_lut_size_);
+
+	for (unsigned int lut = 0; lut < num_luts; lut++)
+	{
+		unsigned int numerator = (esf_schedule_.length() > 0) ? esf_schedule_[lut] : esf_numerator_;
+
+		for (unsigned int msg = 0; msg < esf_lut_size_; msg++)
+		{
+			if (esf_denominator_ != 0)
+			{
+				// Scale with numerator / denominator, round half up.
+				scaled = (msg * numerator + esf_denominator_ / 2) / esf_denominator_;
+			}
+			else if (esf_factor_ == 0.875)
+			{
+				// Multiply with 0.875 like it is done in the hardware.
+				scaled = ( ((msg << 1) +
+				            (msg << 0) +
+				            (msg >> 1) + 1) >> 2);
+			}
+			else if (esf_factor_ == 0.75)
+			{
+				// Multiply with 0.75 like it is done in the hardware.
+				scaled = ( ((msg << 1) + (msg << 0) + 1) >> 2);
+			}
+			else
+			{
+				// Any other factor, round half up.
+				scaled = static_cast<unsigned int>(msg * esf_factor_ + 0.5);
+			}
+
+			esf_lut_[lut * esf_lut_size_ + msg] = (scaled > esf_offset_) ? scaled - esf_offset_ : 0;
+		}
+	}
+}
+
+
+const unsigned int* Decoder_LDPC_Binary_HW_Share::Get_Esf_Lut(int iter)
+{
+	unsigned int lut = 0;
+
+	if (esf_schedule_.length() > 0)
+		lut = ((unsigned int) iter < esf_schedule_.length()) ? iter : esf_schedule_.length() - 1;
+
+	return &esf_lut_[lut * esf_lut_size_];
+}
+
+
+/// Identification of the trace format
+static const char trace_magic[8] = {'L', 'D', 'P', 'C', 'T', 'R', 'C', '1'};
+
+/// Version of the trace format
+static const unsigned int trace_version = 1;
+
+
+/// Append a value to a trace header in memory.
+template <class T>
+static void Trace_Put(std::vector<char> &header, const T &value)
+{
+	const char *bytes = reinterpret_cast<const char *>(&value);
+	header.insert(header.end(), bytes, bytes + sizeof(T));
+}
+
+
+/// Read a value from a trace file.
+template <class T>
+static void Trace_Get(std::FILE *file, T &value)
+{
+	if (fread(&value, sizeof(T), 1, file) != 1)
+		throw runtime_error("\nException[Decoder_LDPC_Binary_HW_Share]: Trace header is incomplete!");
+}
+
+
+/// Append a Buffer with its length to a trace header in memory.
+static void Trace_Put_Buffer(std::vector<char> &header, const Buffer<unsigned int> &buffer)
+{
+	Trace_Put(header, buffer.length());
+	for (unsigned int i = 0; i < buffer.length(); i++)
+		Trace_Put(header, buffer[i]);
+}
+
+
+/// Read a Buffer with its length from a trace file.
+static void Trace_Get_Buffer(std::FILE *file, Buffer<unsigned int> &buffer)
+{
+	unsigned int length;
+
+	Trace_Get(file, length);
+	buffer.Resize(length);
+	for (unsigned int i = 0; i < length; i++)
+		Trace_Get(file, buffer[i]);
+}
+
+
+void Decoder_LDPC_Binary_HW_Share::Trace_Header(std::vector<char> &header)
+{
+	unsigned int num_cng = num_check_nodes_ / dst_parallelism_;
+	unsigned int algorithm = check_node_algorithm_;
+	unsigned int is_IRA_code = is_IRA_code_;
+
+	header.assign(trace_magic, trace_magic + sizeof(trace_magic));
+
+	Trace_Put(header, trace_version);
+	Trace_Put(header, algorithm);
+	Trace_Put(header, num_lambda_min_);
+	Trace_Put(header, bw_fract_);
+	Trace_Put(header, max_msg_extr_);
+	Trace_Put(header, max_msg_app_);
+	Trace_Put(header, esf_factor_);
+	Trace_Put(header, esf_numerator_);
+	Trace_Put(header, esf_denominator_);
+	Trace_Put(header, esf_offset_);
+	Trace_Put(header, num_partitions_);
+	Trace_Put(header, threshold_);
+	Trace_Put(header, num_variable_nodes_);
+	Trace_Put(header, num_check_nodes_);
+	Trace_Put(header, max_check_degree_);
+	Trace_Put(header, src_parallelism_);
+	Trace_Put(header, dst_parallelism_);
+	Trace_Put(header, is_IRA_code);
+	Trace_Put_Buffer(header, esf_schedule_);
+	Trace_Put_Buffer(header, partition_map_);
+	Trace_Put_Buffer(header, partition_neighbors_);
+
+	for (unsigned int i = 0; i < num_cng * max_check_degree_; i++)
+		Trace_Put(header, addr_vector_[i]);
+}
+
+
+void Decoder_LDPC_Binary_HW_Share::Open_Trace(const std::string &file_name)
+{
+	Close_Trace();
+
+	trace_file_ = fopen(file_name.c_str(), "wb");
+	if (trace_file_ == NULL)
+		throw runtime_error("\nException[Decoder_LDPC_Binary_HW_Share]: Cannot open trace file " + file_name + "!");
+
+	Trace_Header(trace_header_);
+	if (fwrite(&trace_header_[0], trace_header_.size(), 1, trace_file_) != 1)
+		throw runtime_error("\nException[Decoder_LDPC_Binary_HW_Share]: Writing the trace failed!");
+
+	trace_records_.Resize(num_check_nodes_ * Trace_Record_Length());
+}
+
+
+bool Decoder_LDPC_Binary_HW_Share::Trace_Header_Changed()
+{
+	std::vector<char> header;
+
+	Trace_Header(header);
+	return header != trace_header_;
+}
+
+
+void Decoder_LDPC_Binary_HW_Share::Close_Trace()
+{
+	if (trace_file_ != NULL)
+		fclose(trace_file_);
+
+	trace_file_ = NULL;
+	trace_active_ = false;
+}
+
+
+void Decoder_LDPC_Binary_HW_Share::Open_Trace_Replay(const std::string &file_name)
+{
+	char magic[sizeof(trace_magic)];
+	unsigned int version;
+	unsigned int algorithm;
+	unsigned int is_IRA_code;
+
+	Close_Trace();
+
+	trace_file_ = fopen(file_name.c_str(), "rb");
+	if (trace_file_ == NULL)
+		throw runtime_error("\nException[Decoder_LDPC_Binary_HW_Share]: Cannot open trace file " + file_name + "!");
+
+	if (fread(magic, sizeof(magic), 1, trace_file_) != 1 ||
+	    memcmp(magic, trace_magic, sizeof(magic)) != 0)
+		throw runtime_error("\nException[Decoder_LDPC_Binary_HW_Share]: " + file_name + " is no LDPC trace!");
+
+	Trace_Get(trace_file_, version);
+	if (version != trace_version)
+		throw runtime_error("\nException[Decoder_LDPC_Binary_HW_Share]: Unsupported trace version!");
+
+	Trace_Get(trace_file_, algorithm);
+	Trace_Get(trace_file_, num_lambda_min_);
+	Trace_Get(trace_file_, bw_fract_);
+	Trace_Get(trace_file_, max_msg_extr_);
+	Trace_Get(trace_file_, max_msg_app_);
+	Trace_Get(trace_file_, esf_factor_);
+	Trace_Get(trace_file_, esf_numerator_);
+	Trace_Get(trace_file_, esf_denominator_);
+	Trace_Get(trace_file_, esf_offset_);
+	Trace_Get(trace_file_, num_partitions_);
+	Trace_Get(trace_file_, threshold_);
+	Trace_Get(trace_file_, num_variable_nodes_);
+	Trace_Get(trace_file_, num_check_nodes_);
+	Trace_Get(trace_file_, max_check_degree_);
+	Trace_Get(trace_file_, src_parallelism_);
+	Trace_Get(trace_file_, dst_parallelism_);
+	Trace_Get(trace_file_, is_IRA_code);
+	Trace_Get_Buffer(trace_file_, esf_schedule_);
+	Trace_Get_Buffer(trace_file_, partition_map_);
+	Trace_Get_Buffer(trace_file_, partition_neighbors_);
+
+	check_node_algorithm_ = static_cast<CHECK_NODE_ENUM>(algorithm);
+	is_IRA_code_ = (is_IRA_code != 0);
+
+	trace_addr_vector_.Resize(num_check_nodes_ / dst_parallelism_ * max_check_degree_);
+	for (unsigned int i = 0; i < trace_addr_vector_.length(); i++)
+		Trace_Get(trace_file_, trace_addr_vector_[i]);
+
+	// The check node functions only need the address vector (Split Row partitions).
+	addr_vector_ = &trace_addr_vector_[0];
+	shft_vector_ = NULL;
+
+	Init_Partition_Tables();
+	Init_Esf_Lut();
+
+	cn_msg_abs_.Resize(max_check_degree_);
+	cn_msg_sign_.Resize(max_check_degree_);
+	trace_records_.Resize(num_check_nodes_ * Trace_Record_Length());
+}
+
+
+unsigned int Decoder_LDPC_Binary_HW_Share::Replay_Trace(unsigned int max_records, unsigned long long &mismatches)
+{
+	unsigned int record_length = Trace_Record_Length();
+	unsigned int num_records;
+	Buffer<int> check_node_io(max_check_degree_);
+	Buffer<int> app_in(max_check_degree_);
+
+	if (max_records > num_check_nodes_)
+		max_records = num_check_nodes_;
+
+	num_records = fread(&trace_records_[0], record_length * sizeof(int), max_records, trace_file_);
+
+	for (unsigned int r = 0; r < num_records; r++)
+	{
+		const int *record = &trace_records_[r * record_length];
+		const int *input  = record + 4;
+		const int *output = input + max_check_degree_;
+		bool equal;
+
+		for (unsigned int i = 0; i < max_check_degree_; i++)
+		{
+			check_node_io[i] = input[i];
+			app_in[i] = output[max_check_degree_ + i];
+		}
+
+		// The parity check is evaluated on the APP values or on the check node input.
+		if (record[3] & 2)
+			equal = ((1 - Calc_Parity_Check(check_node_io)) == static_cast<unsigned int>(record[3] & 1));
+		else
+			equal = ((1 - Calc_Parity_Check(app_in)) == static_cast<unsigned int>(record[3] & 1));
+
+		Check_Node(check_node_io, record[1], record[2], Get_Esf_Lut(record[0]));
+
+		for (unsigned int i = 0; i < max_check_degree_; i++)
+			equal &= (check_node_io[i] == output[i]);
+
+		if (!equal)
+			mismatches++;
+	}
+
+	return num_records;
+}
+
+
+void Decoder_LDPC_Binary_HW_Share::Trace_Check_Node_Input(unsigned int iter,
+                                                          unsigned int cng_counter,
+                                                          unsigned int cfu_counter,
+                                                          Buffer<int>  &check_node_in,
+                                                          Buffer<int>  &app_in,
+                                                          unsigned int parity_check,
+                                                          bool         parity_on_input)
+{
+	int *record = &trace_records_[(cng_counter * dst_parallelism_ + cfu_counter) * Trace_Record_Length()];
+
+	record[0] = iter;
+	record[1] = cng_counter;
+	record[2] = cfu_counter;
+	record[3] = (1 - parity_check) | (parity_on_input ? 2 : 0);
+
+	for (unsigned int i = 0; i < max_check_degree_; i++)
+	{
+		record[4 + i] = check_node_in[i];
+		record[4 + 2 * max_check_degree_ + i] = app_in[i];
+	}
+}
+
+
+void Decoder_LDPC_Binary_HW_Share::Trace_Write_Iteration()
+{
+	if (fwrite(&trace_records_[0], sizeof(int), trace_records_.length(), trace_file_) != trace_records_.length())
+		throw runtime_error("\nException[Decoder_LDPC_Binary_HW_Share]: Writing the trace failed!");
+}
+
+
 void Decoder_LDPC_Binary_HW_Share::Init_APP_RAM(bool            parity_reordering,
                                                 Buffer<int>    &input_bits_llr,
                                                 Buffer<int, 2> &app_ram)
@@ -347,6 +780,11 @@ void Decoder_LDPC_Binary_HW_Share::Write_Check_Node_Output(Buffer<int, 2> &app_r
 			msg_ram[vn_select][vector_addr] = current_message;
 		}
 
+		// Record the updated APP value (0 for unused edges).
+		if (trace_active_)
+			trace_records_[(cng_counter * dst_parallelism_ + cfu_counter) * Trace_Record_Length() +
+			               4 + 3 * max_check_degree_ + cn2vn_msg] = (vng_select > -1) ? app_ram[vn_select][vng_select] : 0;
+
 		vector_addr++;
 	}
 }
@@ -381,6 +819,10 @@ unsigned int Decoder_LDPC_Binary_HW_Share::Decode_Layered(Buffer<int, 2> &app_ra
 	cn_msg_abs_.Resize(max_check_degree_);
 	cn_msg_sign_.Resize(max_check_degree_);
 	unsigned int ok_checks = 0;
+	unsigned int parity_check;
+
+	// Magnitude LUT of the extrinsic scaling in this iteration.
+	const unsigned int *esf_lut = Get_Esf_Lut(iter);
 
 	// Iterate over all check node groups.
 	for(unsigned int cng_counter = 0; cng_counter < num_check_nodes_ / dst_parallelism_; cng_counter++)
@@ -388,27 +830,29 @@ unsigned int Decoder_LDPC_Binary_HW_Share::Decode_Layered(Buffer<int, 2> &app_ra
 		// Iterate over the functional units.
 		for(unsigned int cfu_counter = 0; cfu_counter < dst_parallelism_; cfu_counter++)
 		{
+			LDPC_PERF_BEGIN(GATHER);
 			Get_Check_Node_Input(app_ram, msg_ram, iter, cng_counter, cfu_counter, check_node_io, app_out);
 
-			ok_checks += (1 - Calc_Parity_Check(app_out));
+			parity_check = Calc_Parity_Check(app_out);
+			ok_checks += (1 - parity_check);
+			LDPC_PERF_END(GATHER);
 
-			switch(check_node_algorithm_)
-			{
-			case MIN_SUM:
-            case MIN_SUM_SELF_CORRECTING:
-				Check_Node_Min_Sum(check_node_io, esf_factor_); break;
-			case LAMBDA_MIN:
-				Check_Node_Lambda_Min(check_node_io, num_lambda_min_, bw_fract_); break;
-            case SPLIT_ROW:
-            case SPLIT_ROW_IMPROVED:
-            case SPLIT_ROW_SELF_CORRECTING:
-                Check_Node_Split_Row(check_node_io, esf_factor_, num_partitions_, threshold_, cng_counter); break;
-			}
+			if (trace_active_)
+				Trace_Check_Node_Input(iter, cng_counter, cfu_counter, check_node_io, app_out, parity_check);
 
+			LDPC_PERF_BEGIN(CHECK_NODE);
+			Check_Node(check_node_io, cng_counter, cfu_counter, esf_lut);
+			LDPC_PERF_END(CHECK_NODE);
+
+			LDPC_PERF_BEGIN(SCATTER);
 			Write_Check_Node_Output(app_ram, msg_ram, iter, cng_counter, cfu_counter, check_node_io);
+			LDPC_PERF_END(SCATTER);
 		}
 	}
 
+	if (trace_active_)
+		Trace_Write_Iteration();
+
 	return ok_checks;
 }
 
@@ -422,11 +866,16 @@ unsigned int Decoder_LDPC_Binary_HW_Share::Decode_Layered_Superposed(Buffer<int,
 	cn_msg_abs_.Resize(max_check_degree_);
 	cn_msg_sign_.Resize(max_check_degree_);
 	unsigned int ok_checks = 0;
+	unsigned int parity_check;
+
+	// Magnitude LUT of the extrinsic scaling in this iteration.
+	const unsigned int *esf_lut = Get_Esf_Lut(iter);
 
 	// Iterate over all check node groups.
 	for(unsigned int cng_counter = 0; cng_counter < num_check_nodes_ / dst_parallelism_; cng_counter++)
 	{
 		// Read the input for a whole check node group first.
+		LDPC_PERF_BEGIN(GATHER);
 		for(unsigned int cfu_counter = 0; cfu_counter < dst_parallelism_; cfu_counter++)
 		{
 			Get_Check_Node_Input(app_ram,
@@ -437,43 +886,35 @@ unsigned int Decoder_LDPC_Binary_HW_Share::Decode_Layered_Superposed(Buffer<int,
 			                     check_node_io[cfu_counter],
 			                     app_out);
 
-			ok_checks += (1 - Calc_Parity_Check(app_out));
+			parity_check = Calc_Parity_Check(app_out);
+			ok_checks += (1 - parity_check);
+
+			if (trace_active_)
+				Trace_Check_Node_Input(iter, cng_counter, cfu_counter, check_node_io[cfu_counter], app_out, parity_check);
 		}
+		LDPC_PERF_END(GATHER);
 
 		LM_OUT_LEVEL(LDPC, 2, "CNG: " << cng_counter <<
 		                      " Checks failed: " << dst_parallelism_ * (1 + cng_counter) - ok_checks << endl);
 
 		// Perform the Check Node calculations for all CFUs now.
+		LDPC_PERF_BEGIN(CHECK_NODE);
 		for(unsigned int cfu_counter = 0; cfu_counter < dst_parallelism_; cfu_counter++)
 		{
 			LM_OUT_LEVEL(LDPC, 3, "CNG: " << cng_counter <<
 			                      " CFU: " << cfu_counter <<
 			                      " in: " << check_node_io[cfu_counter] << endl);
 
-			switch(check_node_algorithm_)
-			{
-			case MIN_SUM:
-            case MIN_SUM_SELF_CORRECTING:
-				Check_Node_Min_Sum(check_node_io[cfu_counter], esf_factor_);
-				break;
-
-			case LAMBDA_MIN:
-				Check_Node_Lambda_Min(check_node_io[cfu_counter], num_lambda_min_, bw_fract_);
-				break;
-                // all of the Split Row Algorithms are Split Row Threshold
-            case SPLIT_ROW:
-            case SPLIT_ROW_IMPROVED:
-            case SPLIT_ROW_SELF_CORRECTING:
-                Check_Node_Split_Row(check_node_io[cfu_counter], esf_factor_, num_partitions_, threshold_, cng_counter);
-                break;
-			}
+			Check_Node(check_node_io[cfu_counter], cng_counter, cfu_counter, esf_lut);
 
 			LM_OUT_LEVEL(LDPC, 3, "CNG: " << cng_counter <<
 			                      " CFU: " << cfu_counter <<
 			                      " out: " << check_node_io[cfu_counter] << endl);
 		}
+		LDPC_PERF_END(CHECK_NODE);
 
 		// Write back the result of all check nodes.
+		LDPC_PERF_BEGIN(SCATTER);
 		for(unsigned int cfu_counter = 0; cfu_counter < dst_parallelism_; cfu_counter++)
 			Write_Check_Node_Output(app_ram,
 			                        msg_ram,
@@ -481,10 +922,14 @@ unsigned int Decoder_LDPC_Binary_HW_Share::Decode_Layered_Superposed(Buffer<int,
 			                        cng_counter,
 			                        cfu_counter,
 			                        check_node_io[cfu_counter]);
+		LDPC_PERF_END(SCATTER);
 	}
 
 	LM_OUT_LEVEL(LDPC, 1, "Iter: " << iter << " Checks failed: " << num_check_nodes_ - ok_checks << endl);
 
+	if (trace_active_)
+		Trace_Write_Iteration();
+
 	return ok_checks;
 }
 
@@ -507,8 +952,13 @@ unsigned int Decoder_LDPC_Binary_HW_Share::Decode_Two_Phase(Buffer<int, 2> &app_
 	cn_msg_abs_.Resize(max_check_degree_);
 	cn_msg_sign_.Resize(max_check_degree_);
 	unsigned int ok_checks = 0;
+	unsigned int parity_check;
+
+	// Magnitude LUT of the extrinsic scaling in this iteration.
+	const unsigned int *esf_lut = Get_Esf_Lut(iter);
 
 	// Iterate over all check nodes.
+	LDPC_PERF_BEGIN(GATHER);
 	for(unsigned int cng_counter = 0; cng_counter < num_cng; cng_counter++)
 		for(unsigned int cfu_counter = 0; cfu_counter < dst_parallelism_; cfu_counter++)
 		{
@@ -521,37 +971,28 @@ unsigned int Decoder_LDPC_Binary_HW_Share::Decode_Two_Phase(Buffer<int, 2> &app_
 			                     app_out);
 
 			if (app_parity_check)
-				ok_checks += (1 - Calc_Parity_Check(app_out));
+				parity_check = Calc_Parity_Check(app_out);
 			else
-				ok_checks += (1 - Calc_Parity_Check(check_node_io[cng_counter][cfu_counter]));
+				parity_check = Calc_Parity_Check(check_node_io[cng_counter][cfu_counter]);
+			ok_checks += (1 - parity_check);
+
+			if (trace_active_)
+				Trace_Check_Node_Input(iter, cng_counter, cfu_counter, check_node_io[cng_counter][cfu_counter], app_out,
+				                       parity_check, !app_parity_check);
 		}
+	LDPC_PERF_END(GATHER);
 
 	// Perform the Check Node calculations for all CFUs now.
+	LDPC_PERF_BEGIN(CHECK_NODE);
 	for(unsigned int cng_counter = 0; cng_counter < num_cng; cng_counter++) {
         // cout << cng_counter << " row" << endl;
 		for(unsigned int cfu_counter = 0; cfu_counter < dst_parallelism_; cfu_counter++)
-			switch(check_node_algorithm_)
-			{
-			case MIN_SUM:
-            case MIN_SUM_SELF_CORRECTING:
-				Check_Node_Min_Sum(check_node_io[cng_counter][cfu_counter], esf_factor_);
-				break;
-
-			case LAMBDA_MIN:
-				Check_Node_Lambda_Min(check_node_io[cng_counter][cfu_counter],
-				                      num_lambda_min_,
-				                      bw_fract_);
-				break;
-                // all of the Split Row Algorithms are Split Row Threshold
-            case SPLIT_ROW:
-            case SPLIT_ROW_IMPROVED:
-            case SPLIT_ROW_SELF_CORRECTING:
-                Check_Node_Split_Row(check_node_io[cng_counter][cfu_counter], esf_factor_, num_partitions_, threshold_, cng_counter);
-                break;
-			}
+			Check_Node(check_node_io[cng_counter][cfu_counter], cng_counter, cfu_counter, esf_lut);
     }
+	LDPC_PERF_END(CHECK_NODE);
 
 	// Write back the result of all check nodes.
+	LDPC_PERF_BEGIN(SCATTER);
 	for(unsigned int cng_counter = 0; cng_counter < num_cng; cng_counter++)
 		for(unsigned int cfu_counter = 0; cfu_counter < dst_parallelism_; cfu_counter++)
 			Write_Check_Node_Output(app_ram,
@@ -560,6 +1001,10 @@ unsigned int Decoder_LDPC_Binary_HW_Share::Decode_Two_Phase(Buffer<int, 2> &app_
 			                        cng_counter,
 			                        cfu_counter,
 			                        check_node_io[cng_counter][cfu_counter]);
+	LDPC_PERF_END(SCATTER);
+
+	if (trace_active_)
+		Trace_Write_Iteration();
 
 	return ok_checks;
 }
@@ -570,6 +1015,46 @@ unsigned int Decoder_LDPC_Binary_HW_Share::Decode_Two_Phase(Buffer<int, 2> &app_
  * Check Node Functions *
  ************************/
 
+int Decoder_LDPC_Binary_HW_Share::Check_Node(Buffer<int>        &in_out_msg,
+                                             unsigned int        cng_counter,
+                                             unsigned int        cfu_counter,
+                                             const unsigned int  esf_lut[])
+{
+	int pchk_sign = 1;
+
+	switch(check_node_algorithm_)
+	{
+	case MIN_SUM:
+	case MIN_SUM_SELF_CORRECTING:
+		pchk_sign = Check_Node_Min_Sum(in_out_msg, esf_lut);
+		break;
+
+	case LAMBDA_MIN:
+		pchk_sign = Check_Node_Lambda_Min(in_out_msg, num_lambda_min_, bw_fract_);
+		break;
+
+	// all of the Split Row Algorithms are Split Row Threshold
+	case SPLIT_ROW:
+	case SPLIT_ROW_IMPROVED:
+	case SPLIT_ROW_SELF_CORRECTING:
+		pchk_sign = Check_Node_Split_Row(in_out_msg, esf_lut, num_partitions_, threshold_, cng_counter);
+		break;
+	}
+
+	// Record the check node output.
+	if (trace_active_)
+	{
+		int *output = &trace_records_[(cng_counter * dst_parallelism_ + cfu_counter) * Trace_Record_Length() +
+		                              4 + max_check_degree_];
+
+		for (unsigned int i = 0; i < max_check_degree_; i++)
+			output[i] = in_out_msg[i];
+	}
+
+	return pchk_sign;
+}
+
+
 int Decoder_LDPC_Binary_HW_Share::Check_Node_Lambda_Min(Buffer<int>  &in_out_msg,
                                                         unsigned int  num_lambda_min,
                                                         unsigned int  num_bits_fract)
@@ -643,7 +1128,7 @@ int Decoder_LDPC_Binary_HW_Share::Check_Node_Lambda_Min(Buffer<int>  &in_out_msg
 }
 
 
-int Decoder_LDPC_Binary_HW_Share::Check_Node_Min_Sum(Buffer<int> &in_out_msg, float esf_factor)
+int Decoder_LDPC_Binary_HW_Share::Check_Node_Min_Sum(Buffer<int> &in_out_msg, const unsigned int esf_lut[])
 {
 	unsigned int check_node_degree = in_out_msg.length();
 	unsigned int min0_msg, min1_msg;
@@ -676,22 +1161,9 @@ int Decoder_LDPC_Binary_HW_Share::Check_Node_Min_Sum(Buffer<int> &in_out_msg, fl
 	// Find the second minimum and remember its magnitude and index.
 	min1_msg = Minimum_Fixp(cn_msg_abs_, index);
 
-	if(esf_factor == 0.875)
-	{
-		// Multiply with 0.875 like it is done in the hardware.
-		min0_msg = ( ((min0_msg << 1) +
-		              (min0_msg << 0) +
-		              (min0_msg >> 1) + 1) >> 2);
-		min1_msg = ( ((min1_msg << 1) +
-		              (min1_msg << 0) +
-		              (min1_msg >> 1) + 1) >> 2);
-	}
-	else
-	{
-		// Multiply with 0.75 like it is done in the hardware.
-		min0_msg = ( ((min0_msg << 1) + (min0_msg << 0) + 1) >> 2);
-		min1_msg = ( ((min1_msg << 1) + (min1_msg << 0) + 1) >> 2);
-	}
+	// Scale the minima (and subtract the offset) by table lookup.
+	min0_msg = esf_lut[min0_msg];
+	min1_msg = esf_lut[min1_msg];
 
     // cout << "output" << endl;
 	for(unsigned int i = 0; i < check_node_degree; i++)
@@ -712,7 +1184,7 @@ int Decoder_LDPC_Binary_HW_Share::Check_Node_Min_Sum(Buffer<int> &in_out_msg, fl
 }
 
 // Check_Node_Split_Row: implements Check_Node functionality according to Split-Row Treshold and Split-Row Threshold Improved
-int Decoder_LDPC_Binary_HW_Share::Check_Node_Split_Row(Buffer<int> &in_out_msg, float esf_factor, unsigned int partitions, unsigned int threshold, unsigned int cng_counter)
+int Decoder_LDPC_Binary_HW_Share::Check_Node_Split_Row(Buffer<int> &in_out_msg, const unsigned int esf_lut[], unsigned int partitions, unsigned int threshold, unsigned int cng_counter)
 {
 
     std::vector< std::vector<int> > parts;      // vector that holds partitions
@@ -728,6 +1200,10 @@ int Decoder_LDPC_Binary_HW_Share::Check_Node_Split_Row(Buffer<int> &in_out_msg,
     unsigned int partition_length[partitions]; // array that holds length of each partition
     unsigned int part_length;
 
+    // edges of each partition, compiled by Init_Partition_Tables
+    const unsigned int *part_start = &partition_start_[cng_counter * (partitions + 1)];
+    const unsigned int *part_edges = &partition_edges_[cng_counter * max_check_degree_];
+
     // cout << "input" << endl;
     /*
     for (unsigned int i = 0; i != in_out_msg.length(); i++) {
@@ -736,8 +1212,10 @@ int Decoder_LDPC_Binary_HW_Share::Check_Node_Split_Row(Buffer<int> &in_out_msg,
     */
     // cout << endl << endl;
 
-    // Calculate each partition length
-    Calculate_Partition_Length(partition_length, cng_counter, partitions);
+    // Get each partition length
+    for (unsigned int i = 0; i != partitions; i++) {
+        partition_length[i] = part_start[i + 1] - part_start[i];
+    }
 
     /*
     for (unsigned int i = 0; i != partitions; i++) {
@@ -747,7 +1225,7 @@ int Decoder_LDPC_Binary_HW_Share::Check_Node_Split_Row(Buffer<int> &in_out_msg,
     // cout << endl;
 
     // distribute the messages between the partitions
-    Distribute_Messages_Partitions(parts, in_out_msg, partitions, partition_length);
+    Distribute_Messages_Partitions(parts, in_out_msg, partitions, part_start, part_edges);
 
     /*
     for (unsigned int i = 0; i != partitions; i++) {
@@ -797,29 +1275,34 @@ int Decoder_LDPC_Binary_HW_Share::Check_Node_Split_Row(Buffer<int> &in_out_msg,
             if (local_min1[part_num] <= threshold && local_min2[part_num] <= threshold) {
                 // condition 1
                 // cout << "condition 1" << endl;
+                split_row_conditions_[CONDITION_1]++;
                 Update_Minimum(temp_parts[part_num], min1_idx[part_num], local_min1[part_num], local_min2[part_num], partition_length[part_num]);
             } else if (local_min1[part_num] <= threshold && local_min2[part_num] > threshold) {
                 // condition 2
                 // cout << "condition 2" << endl;
-                if (Neighbors_Threshold_Enable(part_num, partitions, threshold_en)) {
+                if (Neighbors_Threshold_Enable(part_num, threshold_en)) {
                     // condition 2a
                     // cout << "condition 2a" << endl;
+                    split_row_conditions_[CONDITION_2A]++;
                     Update_Minimum(temp_parts[part_num], min1_idx[part_num], local_min1[part_num], threshold, partition_length[part_num]);
                 } else {
                     // condition 2b
                     // cout << "condition 2b" << endl;
+                    split_row_conditions_[CONDITION_2B]++;
                     Update_Minimum(temp_parts[part_num], min1_idx[part_num], local_min1[part_num], local_min2[part_num], partition_length[part_num]);
                 }
-            } else if (local_min1[part_num] > threshold && Neighbors_Threshold_Enable(part_num, partitions, threshold_en)) {
+            } else if (local_min1[part_num] > threshold && Neighbors_Threshold_Enable(part_num, threshold_en)) {
                 // condition 3
                 // cout << "condition 3" << endl;
+                split_row_conditions_[CONDITION_3]++;
                 Update_Minimum(temp_parts[part_num], min1_idx[part_num], threshold, threshold, partition_length[part_num]);
             } else {
                 // condition 4
                 // cout << "condition 4" << endl;
+                split_row_conditions_[CONDITION_4]++;
                 Update_Minimum(temp_parts[part_num], min1_idx[part_num], local_min1[part_num], local_min2[part_num], partition_length[part_num]);
             }
-            Multiply_Sign_Esf(parts[part_num], temp_parts[part_num], sign_part[part_num], esf_factor, part_length);
+            Multiply_Sign_Esf(parts[part_num], temp_parts[part_num], sign_part[part_num], esf_lut, part_length);
         }
 
     } else {
@@ -832,35 +1315,32 @@ int Decoder_LDPC_Binary_HW_Share::Check_Node_Split_Row(Buffer<int> &in_out_msg,
                 part_length += partition_length[part_num - 1];
             }
 
-            if (local_min1[part_num] > threshold && Neighbors_Threshold_Enable(part_num, partitions, threshold_en)) {
+            if (local_min1[part_num] > threshold && Neighbors_Threshold_Enable(part_num, threshold_en)) {
                 // condition 3
                 // cout << "condition 3 of split row threshold" << endl;
+                split_row_conditions_[CONDITION_3]++;
                 Update_Minimum(temp_parts[part_num], min1_idx[part_num], threshold, threshold, partition_length[part_num]);
             } else {
                 // condition 1 and 4
                 // cout << "condition 1 and 4 of split row threshold" << endl;
+                split_row_conditions_[(local_min1[part_num] <= threshold) ? CONDITION_1 : CONDITION_4]++;
                 Update_Minimum(temp_parts[part_num], min1_idx[part_num], local_min1[part_num], local_min2[part_num], partition_length[part_num]);
             }
             // multiply min with local sign and own sign
-            Multiply_Sign_Esf(parts[part_num], temp_parts[part_num], sign_part[part_num], esf_factor, part_length);
+            Multiply_Sign_Esf(parts[part_num], temp_parts[part_num], sign_part[part_num], esf_lut, part_length);
         }
     }
 
-    // Also consider the sign of the adjacent partitions
-    for (unsigned int part_num = 1; part_num != partitions; part_num++) {
-        Multiply_Split_Sign_Signal(parts[part_num - 1], sign_part[part_num]);
-        Multiply_Split_Sign_Signal(parts[part_num], sign_part[part_num - 1]);
-        if (part_num == 1) {
-            // if is the first time, then multiply the sign of first and second partition
-            // else keep multiply new partition sign with the accumulated one
-            pchk_sign = sign_part[part_num - 1] * sign_part[part_num];
-        } else {
-            pchk_sign *= sign_part[part_num];
+    // Also consider the sign of the neighboring partitions
+    for (unsigned int part_num = 0; part_num != partitions; part_num++) {
+        for (unsigned int i = neighbor_start_[part_num]; i != neighbor_start_[part_num + 1]; i++) {
+            Multiply_Split_Sign_Signal(parts[part_num], sign_part[neighbor_list_[i]]);
         }
+        pchk_sign *= sign_part[part_num];
     }
 
     // put everything in in_out_msg so it can be read in the variable node again
-    Regroup_Messages_Partitions(parts, in_out_msg, partition_length);
+    Regroup_Messages_Partitions(parts, in_out_msg, partitions, part_start, part_edges);
 
     return pchk_sign;
 }
@@ -911,15 +1391,13 @@ void Decoder_LDPC_Binary_HW_Share::Calculate_Partition_Length(unsigned int parti
 
 
 // Distribute_Messages_Partitions: distributes messages from variable node (in_out_msg) between partitions
-void Decoder_LDPC_Binary_HW_Share::Distribute_Messages_Partitions(std::vector< std::vector<int> > &parts, Buffer<int> &in_out_msg, unsigned int partitions, unsigned int partition_length[])
+void Decoder_LDPC_Binary_HW_Share::Distribute_Messages_Partitions(std::vector< std::vector<int> > &parts, Buffer<int> &in_out_msg, unsigned int partitions, const unsigned int part_start[], const unsigned int part_edges[])
 {
-    // we need to change this function for variable size partitions
-    unsigned int last_pos = 0;
+    // the edges of each partition are given by the partition tables
     for (unsigned int i = 0; i != partitions; i++) {
-        for (unsigned int j = 0; j != partition_length[i]; j++) {
-            parts[i].push_back(in_out_msg[last_pos + j]);
+        for (unsigned int j = part_start[i]; j != part_start[i + 1]; j++) {
+            parts[i].push_back(in_out_msg[part_edges[j]]);
         }
-        last_pos += partition_length[i];
     }
    
 }
@@ -967,17 +1445,15 @@ int Decoder_LDPC_Binary_HW_Share::Split_Row_Local_Minimum_Sign(std::vector<int>&
 }
 
 
-//bool Decoder_LDPC_Binary_HW_Share::Neighbors_Threshold_Enable(unsigned int part_num, unsigned int partitions, unsigned int threshold_en[])
 // Neighbors_Threshold_Enable: returns true if any of the neigboring partitions has threshold_en asserted, else false
-bool Decoder_LDPC_Binary_HW_Share::Neighbors_Threshold_Enable(unsigned int part_num, unsigned int partitions, std::vector<unsigned int>& threshold_en)
+bool Decoder_LDPC_Binary_HW_Share::Neighbors_Threshold_Enable(unsigned int part_num, std::vector<unsigned int>& threshold_en)
 {
-    if (part_num == 0) {
-        return threshold_en[1];
-    } else if (part_num == partitions - 1) {
-        return threshold_en[part_num - 1];
-    } else {
-        return threshold_en[part_num - 1] || threshold_en[part_num + 1];
+    for (unsigned int i = neighbor_start_[part_num]; i != neighbor_start_[part_num + 1]; i++) {
+        if (threshold_en[neighbor_list_[i]]) {
+            return true;
+        }
     }
+    return false;
 }
 
 // Update_Minimum: stores the magnitude of that splitted row
@@ -999,24 +1475,14 @@ void Decoder_LDPC_Binary_HW_Share::Update_Minimum(std::vector<unsigned int>& tem
 }
 
 // Multiply_Sign_Esf: Multiplies magnitude and local sign and esf factor and stores it in signed representation (vector <> part)
-void Decoder_LDPC_Binary_HW_Share::Multiply_Sign_Esf(std::vector<int>& part, std::vector<unsigned int>& temp_part, int local_pchk_sign, float esf_factor, unsigned int part_length)
+void Decoder_LDPC_Binary_HW_Share::Multiply_Sign_Esf(std::vector<int>& part, std::vector<unsigned int>& temp_part, int local_pchk_sign, const unsigned int esf_lut[], unsigned int part_length)
 {
     assert(part.size() == temp_part.size());
     unsigned int check_node_degree = part.size();
 	for(unsigned int i = 0; i < check_node_degree; i++)
 	{
-        if (esf_factor == 0.875)
-        {
-            // Multiply with 0.875 like it is done in the hardware.
-            temp_part[i] = (((temp_part[i] << 1) + 
-                        (temp_part[i] << 0) + 
-                        (temp_part[i] >> 1) + 1) >> 2);
-        }
-        else if (esf_factor == 0.75)
-        {
-            // Multiply with 0.75 like it is done in the hardware.
-            temp_part[i] = ( ((temp_part[i] << 1) + (temp_part[i] << 0) + 1) >> 2);
-        }
+        // Scale the magnitude (and subtract the offset) by table lookup.
+        temp_part[i] = esf_lut[temp_part[i]];
 
         // Calculate new outgoing edge with new sign and new magnitude.
         // we need j in order to multiply it with correct sign (remember multiple partitions)
@@ -1039,23 +1505,14 @@ void Decoder_LDPC_Binary_HW_Share::Multiply_Split_Sign_Signal(std::vector<int>&
 }
 
 // Regroup_Messages_Partitions: Regroups messages of all partitions in Buffer<in_out_msg> used in Write_Check_Node_Output
-void Decoder_LDPC_Binary_HW_Share::Regroup_Messages_Partitions(std::vector< std::vector<int> > &parts, Buffer<int> &in_out_msg, unsigned int partition_length[])
+void Decoder_LDPC_Binary_HW_Share::Regroup_Messages_Partitions(std::vector< std::vector<int> > &parts, Buffer<int> &in_out_msg, unsigned int partitions, const unsigned int part_start[], const unsigned int part_edges[])
 {
-    // cout << "output" << endl;
-    for (unsigned int i = 0, j = 0, k = 0; i != in_out_msg.length(); i++, k++) {
-        /* 
-         * if i reaches the lenght of a row of a partition
-         * then we have finished reading this partition,
-         * so we grab the next partition (increment j)
-         */
-        if (k != 0 && k == partition_length[j]) {
-            j++;
-            k = 0;
+    // write each message back to the edge it was taken from
+    for (unsigned int i = 0; i != partitions; i++) {
+        for (unsigned int j = part_start[i]; j != part_start[i + 1]; j++) {
+            in_out_msg[part_edges[j]] = parts[i][j - part_start[i]];
         }
-        in_out_msg[i] = parts[j][k];
-        // cout << "in_out_msg[" << i << "] = " << in_out_msg[i] << endl;
     }
-    // cout << endl;
 
 }
 
@@ -1131,6 +1588,24 @@ unsigned int Decoder_LDPC_Binary_HW_Share::Calc_Modified_Systematic_Bits(unsigne
 	return no_modified_systematic_bits;
 }
 
+unsigned int Decoder_LDPC_Binary_HW_Share::Calc_Saturated_APP_Values(unsigned int    iter,
+                                                                     Buffer<int, 2> &output_bits_llr_app)
+{
+	unsigned int saturated_values = 0;
+
+	// The APP values saturate at max_msg_app_ and - max_msg_app_ - 1.
+	for (unsigned int i = 0; i < num_variable_nodes_; i++)
+	{
+		if (output_bits_llr_app[iter][i] >= (signed) max_msg_app_ ||
+		    output_bits_llr_app[iter][i] <  - (signed) max_msg_app_)
+		{
+			saturated_values++;
+		}
+	}
+
+	return saturated_values;
+}
+
 unsigned int Decoder_LDPC_Binary_HW_Share::Calc_Flipped_Bits(unsigned int iter, Buffer<unsigned int, 2> &output_bits)
 {
     unsigned int flipped_bits = 0;
@@ -14,8 +14,11 @@
 #define DEC_LDPC_BIN_HW_SHARE_H_
 
 #include <cstdlib>
+#include <cstdio>
+#include <vector>
 #include "cse_lib.h"
 #include "../assistance/buffer.h"
+#include "dec_ldpc_perf_counters.h"
 
 namespace cse_lib {
 
@@ -28,8 +31,8 @@ class Decoder_LDPC_Binary_HW_Share
 
 public:
 
-	Decoder_LDPC_Binary_HW_Share() { };
-	virtual ~Decoder_LDPC_Binary_HW_Share() { };
+	Decoder_LDPC_Binary_HW_Share() : trace_file_(NULL), trace_active_(false) { Reset_Split_Row_Conditions(); };
+	virtual ~Decoder_LDPC_Binary_HW_Share() { Close_Trace(); };
 
 	/// LDPC check node algorithms
 	enum CHECK_NODE_ENUM {
@@ -42,6 +45,16 @@ public:
 
 	};
 
+	/// Threshold conditions of the Split-Row check node, see Check_Node_Split_Row()
+	enum SPLIT_ROW_CONDITION_ENUM {
+		CONDITION_1,  /*!< Both local minima below or equal to the threshold */
+		CONDITION_2A, /*!< Only min1 below or equal to the threshold, a neighbor enabled the threshold */
+		CONDITION_2B, /*!< Only min1 below or equal to the threshold, no neighbor enabled the threshold */
+		CONDITION_3,  /*!< min1 above the threshold, a neighbor enabled the threshold */
+		CONDITION_4,  /*!< min1 above the threshold, no neighbor enabled the threshold */
+		NUM_SPLIT_ROW_CONDITIONS
+	};
+
 protected:
 
 
@@ -62,12 +75,70 @@ protected:
 	/// Extrinsic scaling factor for Min-Sum algorithm
 	float esf_factor_;
 
+	/// Numerator of the extrinsic scaling, used instead of esf_factor_ if esf_denominator_ != 0
+	unsigned int esf_numerator_;
+
+	/// Denominator of the extrinsic scaling, 0 selects esf_factor_
+	unsigned int esf_denominator_;
+
+	/// Offset subtracted from the scaled check node output magnitudes (Offset Min-Sum)
+	unsigned int esf_offset_;
+
+	/// Numerator for each iteration, the last entry holds for further iterations (empty: esf_numerator_)
+	Buffer<unsigned int> esf_schedule_;
+
     /// Number of Partitions (Split Row)
     unsigned int num_partitions_;
 
     /// Threshold (threshold split Row)
     unsigned int threshold_;
 
+    /// Partition of each edge of a check node (Split Row), empty for contiguous partitions
+    /**
+     * Holds either max_check_degree_ entries that apply to all check node
+     * groups or max_check_degree_ entries for each check node group.
+     */
+    Buffer<unsigned int> partition_map_;
+
+    /// Pairs of neighboring partitions (Split Row), empty for adjacent partitions
+    Buffer<unsigned int> partition_neighbors_;
+
+
+	/*
+	 * Tracing
+	 */
+
+	/// Trace file, NULL if not open
+	std::FILE *trace_file_;
+
+	/// Record check node data of the current frame into the trace, see Open_Trace()
+	bool trace_active_;
+
+#ifdef LDPC_PERF_COUNTERS
+	/// Hardware performance counters of the decoder phases
+	Decoder_LDPC_Perf_Counters perf_counters_;
+#endif
+
+
+	/*
+	 * Convergence statistics
+	 */
+
+	/// Number of partitions that took each threshold condition since the last reset
+	/**
+	 * The plain SPLIT_ROW algorithm does not distinguish conditions 1, 2 and 4,
+	 * a partition that is not in condition 3 is counted as CONDITION_1 if its
+	 * min1 is below or equal to the threshold and as CONDITION_4 otherwise.
+	 */
+	ull_int split_row_conditions_[NUM_SPLIT_ROW_CONDITIONS];
+
+	/// Set all Split-Row condition counters to zero.
+	void Reset_Split_Row_Conditions()
+	{
+		for (unsigned int i = 0; i < NUM_SPLIT_ROW_CONDITIONS; i++)
+			split_row_conditions_[i] = 0;
+	}
+
 
 	/*
 	 * Quantization
@@ -117,6 +188,94 @@ protected:
 	 ****************************************************/
 
 
+	/// Compile partition_map_ and partition_neighbors_ into the Split Row index tables.
+	/**
+	 * Has to be called whenever the code, num_partitions_ or one of the
+	 * partition descriptions changed. Without a partition map the edges of each
+	 * check node group are split into contiguous partitions of the lengths of
+	 * Calculate_Partition_Length(), with the invalid edges in the last
+	 * partition. Any other split, e.g. spreading the remainder of the valid
+	 * edges over several partitions, is given by partition_map_. Without
+	 * neighbor pairs each partition is neighbor of its left and right
+	 * partition.
+	 */
+	void Init_Partition_Tables();
+
+
+	/// Open a binary trace file and write its header.
+	/**
+	 * While trace_active_ is set, the decoder functions record for each check
+	 * node and iteration the check node input and output, the APP values used
+	 * for the parity check, the updated APP values and the parity check result.
+	 * The header holds all parameters of the check node functions, such that
+	 * a trace can be replayed without configuration, see Replay_Trace().
+	 * Has to be called after the code and decoding parameters are set.
+	 *
+	 * Trace format (native int, little endian on x86):
+	 *  - header: "LDPCTRC1", version, parameters, esf_schedule_,
+	 *    partition_map_, partition_neighbors_ and the address vector
+	 *  - one record per check node and iteration: iter, cng, cfu, parity
+	 *    flags (bit 0: satisfied, bit 1: checked on the input instead of the
+	 *    APP values), input[max_check_degree_], output[max_check_degree_],
+	 *    APP in[max_check_degree_], APP out[max_check_degree_]
+	 *
+	 * \param file_name  Name of the trace file, an existing file is overwritten.
+	 */
+	void Open_Trace(const std::string &file_name);
+
+
+	/// Close the trace file (if open).
+	void Close_Trace();
+
+
+	/// Does the trace header of the current parameters differ from the one of the open trace?
+	/**
+	 * The records of a trace are only valid for the parameters in its header,
+	 * so a trace must not be continued after such a change.
+	 */
+	bool Trace_Header_Changed();
+
+
+	/// Open a trace file for replay and configure the check node functions from its header.
+	/**
+	 * \param file_name  Name of the trace file.
+	 */
+	void Open_Trace_Replay(const std::string &file_name);
+
+
+	/// Replay records of a trace opened by Open_Trace_Replay().
+	/**
+	 * Runs the configured check node function on the recorded inputs and
+	 * compares outputs and parity check results bit by bit.
+	 *
+	 * \param max_records  Maximum number of records to replay.
+	 * \param mismatches   Incremented by the number of records that differ.
+	 *
+	 * \return Number of records replayed, 0 at the end of the trace.
+	 */
+	unsigned int Replay_Trace(unsigned int max_records, unsigned long long &mismatches);
+
+
+	/// Precompute the magnitude LUTs of the extrinsic scaling and offset.
+	/**
+	 * Has to be called whenever the quantization, the threshold or one of the
+	 * scaling parameters changed. Each LUT maps a check node output magnitude
+	 * to max(round(magnitude * scaling) - esf_offset_, 0), one LUT per entry of
+	 * esf_schedule_. Without esf_denominator_ the scaling is esf_factor_, where
+	 * 0.75 and 0.875 are computed by the shift-add trees of the hardware.
+	 */
+	void Init_Esf_Lut();
+
+
+	/// Get the magnitude LUT of the extrinsic scaling for an iteration.
+	/**
+	 * \param iter  Current decoder iteration (starting from 0)
+	 *
+	 * \return Pointer to the LUT, indexed by the magnitude.
+	 */
+	const unsigned int* Get_Esf_Lut(int iter);
+
+
 	/// Modify left shifts to right shifts, in order to be compliant with the C++ code.
 	/**
 	 * The decoder functions of this class only perform right shifting of
@@ -136,6 +295,25 @@ protected:
 	void Saturate(int *input, int max_value);
 
 
+	/// Check node according to check_node_algorithm_.
+	/**
+	 * Dispatches to the check node functions below and records the output if
+	 * tracing is active.
+	 *
+	 * \param in_out_msg   Input/Output array of messages to/from the check node.
+	 * \param cng_counter  Check node group counter
+	 * \param cfu_counter  Check node functional unit counter (within the check node group)
+	 * \param esf_lut      Magnitude LUT of the extrinsic scaling, see Get_Esf_Lut().
+	 *
+	 * \return -1 : Parity check was not satisfied.
+	 * \return  1 : Parity check was satisfied.
+	 */
+	int Check_Node(Buffer<int> &in_out_msg,
+	               unsigned int cng_counter,
+	               unsigned int cfu_counter,
+	               const unsigned int esf_lut[]);
+
+
 	/// Check node implementation according to Lambda-Min algorithm
 	/**
 	 * This function takes quantized values and performs the check node
@@ -157,51 +335,50 @@ protected:
 	/// Check node implementation according to Min-Sum algorithm
 	/**
 	 * This function takes quantized values and performs the check node
-	 * operation according to the Min-Sum approximation. The extrinsic scaling
-	 * factor esf_factor is used for output scaling.
+	 * operation according to the Min-Sum approximation. The magnitude LUT
+	 * esf_lut is used for output scaling and offset.
 	 *
 	 * \param in_out_msg[]   Input/Output array of messages to/from the check
 	 *                       node.
-	 * \param esf_factor     Extrinsic scaling factor: Supported are 0.75 and 0.875.
+	 * \param esf_lut        Magnitude LUT of the extrinsic scaling, see Get_Esf_Lut().
 	 *
 	 * \return -1 : Parity check was not satisfied.
 	 * \return  1 : Parity check was satisfied.
 	 */
-	int Check_Node_Min_Sum(Buffer<int> &in_out_msg, float esf_factor);
+	int Check_Node_Min_Sum(Buffer<int> &in_out_msg, const unsigned int esf_lut[]);
     
     /// Check node implementation according to Multi-Split-Row
 	/**
 	 * This function takes quantized values and performs the check node
-	 * operation according to the Min-Sum approximation. The extrinsic scaling
-	 * factor esf_factor is used for output scaling.
+	 * operation according to the Min-Sum approximation. The magnitude LUT
+	 * esf_lut is used for output scaling and offset.
 	 *
 	 * \param in_out_msg[]   Input/Output array of messages to/from the check
 	 *                       node.
-	 * \param esf_factor     Extrinsic scaling factor: Supported are 0.75 and 0.875.
+	 * \param esf_lut        Magnitude LUT of the extrinsic scaling, see Get_Esf_Lut().
      *
      * \param num_partitions Number of partitions to divide Parity Check Matrix
 	 *
 	 * \return -1 : Parity check was not satisfied.
 	 * \return  1 : Parity check was satisfied.
 	 */
-	int Check_Node_Split_Row(Buffer<int> &in_out_msg, float esf_factor, unsigned int num_partitions, unsigned int threshold, unsigned int cng_counter);
+	int Check_Node_Split_Row(Buffer<int> &in_out_msg, const unsigned int esf_lut[], unsigned int num_partitions, unsigned int threshold, unsigned int cng_counter);
 
     void Calculate_Partition_Length(unsigned int partition_length[], unsigned int cng_counter, unsigned int partitions);
     
-    void Distribute_Messages_Partitions(std::vector< std::vector<int> > &parts, Buffer<int> &in_out_msg, unsigned int partitions, unsigned int partition_length[]);
+    void Distribute_Messages_Partitions(std::vector< std::vector<int> > &parts, Buffer<int> &in_out_msg, unsigned int partitions, const unsigned int part_start[], const unsigned int part_edges[]);
 
     int Split_Row_Local_Minimum_Sign(std::vector<int>& part, unsigned int& minimum1, unsigned int& min1_idx, unsigned int& minimum2, unsigned int& threshold_en, unsigned int threshold, unsigned int part_num);
 
-    bool Neighbors_Threshold_Enable(unsigned int part_num, unsigned int partitions, std::vector<unsigned int>& treshold_en);
-//    bool Neighbors_Threshold_Enable(unsigned int part_num, unsigned int partitions, unsigned int treshold_en[]);
+    bool Neighbors_Threshold_Enable(unsigned int part_num, std::vector<unsigned int>& treshold_en);
 
     void Update_Minimum(std::vector<unsigned int>& temp_part, unsigned int min1_idx, unsigned int min1, unsigned int min2, unsigned int len);
 
-    void Multiply_Sign_Esf(std::vector<int>& part, std::vector<unsigned int>& temp_part, int local_pchk_sign, float esf_factor, unsigned int part_num);
+    void Multiply_Sign_Esf(std::vector<int>& part, std::vector<unsigned int>& temp_part, int local_pchk_sign, const unsigned int esf_lut[], unsigned int part_num);
 
     void Multiply_Split_Sign_Signal(std::vector<int>& part, int split_sign);
 
-    void Regroup_Messages_Partitions(std::vector< std::vector<int> > &parts, Buffer<int> &in_out_msg, unsigned int partition_length[]);
+    void Regroup_Messages_Partitions(std::vector< std::vector<int> > &parts, Buffer<int> &in_out_msg, unsigned int partitions, const unsigned int part_start[], const unsigned int part_edges[]);
 
     unsigned int Minimum_Fixp_Split_Row(Buffer<unsigned int> &message, unsigned int& idx, unsigned int part_num, unsigned int len);
 
@@ -259,6 +436,15 @@ protected:
 	                                           Buffer<unsigned int, 2> &output_bits);
 
 
+	/// Calculate the number of APP values of an iteration that are saturated.
+	/**
+	 * \param iter                 The iteration to check for.
+	 * \param output_bits_llr_app  The APP values of the LDPC decoder, for each iteration.
+	 */
+	unsigned int Calc_Saturated_APP_Values(unsigned int     iter,
+	                                       Buffer<int, 2>  &output_bits_llr_app);
+
+
 	/// Layered LDPC decoder function. Each call corresponds to a single iteration.
 	/**
 	 * This function contains the LDPC decoder itself. Each call corresponds to a
@@ -453,6 +639,51 @@ private:
 	Buffer<unsigned int> cn_msg_abs_;
 	Buffer<int> cn_msg_sign_;
 
+	/// Records of the current iteration, one per check node
+	Buffer<int> trace_records_;
+
+	/// Header of the open trace, see Trace_Header()
+	std::vector<char> trace_header_;
+
+	/// Trace header of the current parameters, see Open_Trace().
+	void Trace_Header(std::vector<char> &header);
+
+	/// Address vector read from a trace for replay
+	Buffer<int> trace_addr_vector_;
+
+	/// Number of ints of a trace record
+	unsigned int Trace_Record_Length() { return 4 + 4 * max_check_degree_; }
+
+	/// Record the check node input, see Open_Trace().
+	void Trace_Check_Node_Input(unsigned int iter,
+	                            unsigned int cng_counter,
+	                            unsigned int cfu_counter,
+	                            Buffer<int>  &check_node_in,
+	                            Buffer<int>  &app_in,
+	                            unsigned int parity_check,
+	                            bool         parity_on_input = false);
+
+	/// Write the records of an iteration to the trace file.
+	void Trace_Write_Iteration();
+
+	/// Magnitude LUTs of the extrinsic scaling, esf_lut_size_ entries for each LUT
+	Buffer<unsigned int> esf_lut_;
+
+	/// Number of entries of a single magnitude LUT
+	unsigned int esf_lut_size_;
+
+	/// Split Row: for each check node group num_partitions_ + 1 offsets into partition_edges_
+	Buffer<unsigned int> partition_start_;
+
+	/// Split Row: for each check node group the edges ordered by partition
+	Buffer<unsigned int> partition_edges_;
+
+	/// Split Row: num_partitions_ + 1 offsets into neighbor_list_
+	Buffer<unsigned int> neighbor_start_;
+
+	/// Split Row: neighbors of each partition
+	Buffer<unsigned int> neighbor_list_;
+
 };
 }
 #endif // DEC_LDPC_BIN_HW_SHARE_H_
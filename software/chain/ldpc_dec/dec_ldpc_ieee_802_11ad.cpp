@@ -29,9 +29,15 @@ void Decoder_LDPC_IEEE_802_11ad::Set_LDPC_Parameters()
 	check_node_algorithm_ = dec_algorithm();
 	num_lambda_min_       = num_lambda_min();
 	esf_factor_           = esf_factor();
+	esf_numerator_        = esf_numerator();
+	esf_denominator_      = esf_denominator();
+	esf_offset_           = esf_offset();
+	esf_schedule_         = esf_schedule();
 	bw_fract_             = bw_fract();
     num_partitions_       = num_partitions();
     threshold_            = threshold();
+    partition_map_        = partition_map();
+    partition_neighbors_  = partition_neighbors();
 
 	// Calculate the maximum values that can be represented by the chosen quantization.
 	max_msg_extr_         = (1 << (bw_extr() - 1)) - 1;  // max_msg_extr = 31
@@ -87,6 +93,28 @@ void Decoder_LDPC_IEEE_802_11ad::Set_LDPC_Parameters()
 		break;
 
 	}
+
+	// Compile the partitions of the Split Row check nodes for the selected code.
+	try
+	{
+		Init_Partition_Tables();
+	}
+	catch(invalid_argument&)
+	{
+		Msg(ERROR, instance_name(), "Invalid partition_map or partition_neighbors!");
+		throw;
+	}
+
+	// Precompute the extrinsic scaling for the chosen quantization.
+	try
+	{
+		Init_Esf_Lut();
+	}
+	catch(invalid_argument&)
+	{
+		Msg(ERROR, instance_name(), "Invalid extrinsic scaling parameters!");
+		throw;
+	}
 }
 
 
@@ -98,6 +126,45 @@ void Decoder_LDPC_IEEE_802_11ad::Init()
 
 	mean_iterations.Reset();
     flipped_bits.Reset();
+	unsatisfied_checks.Reset();
+	split_row_conditions.Reset();
+
+	// Preallocate the saturation histograms, 0 ... 100 percent.
+	for (unsigned int i = 1; i <= num_iterations(); i++)
+		app_saturation(i)().range(0, 100);
+
+#ifdef LDPC_PERF_COUNTERS
+	perf_counters_.Reset();
+	if (!perf_counters_.Available())
+		Msg(WARNING, instance_name(), "Performance counters are not accessible, check kernel.perf_event_paranoid!");
+#endif
+
+	// All simulation points go into the same trace, reopen only if the name changes.
+	try
+	{
+		if (trace_file().empty())
+		{
+			Close_Trace();
+			trace_file_name_.clear();
+		}
+		else if (trace_file_name_ != trace_file())
+		{
+			Open_Trace(trace_file());
+			trace_file_name_ = trace_file();
+			trace_frames_ = 0;
+		}
+		else if (trace_file_ != NULL && Trace_Header_Changed())
+		{
+			// The records are only valid for the parameters in the header of the file.
+			Msg(WARNING, instance_name(), "Decoder parameters changed, trace file " + trace_file() + " is closed!");
+			Close_Trace();
+		}
+	}
+	catch(runtime_error&)
+	{
+		Msg(ERROR, instance_name(), "Cannot write trace file " + trace_file() + "!");
+		throw;
+	}
 
 	// Resize output buffers and internal RAMs.
 	try
@@ -105,6 +172,7 @@ void Decoder_LDPC_IEEE_802_11ad::Init()
 		// Output RAM content for each iteration.
 		output_bits().Resize(num_iterations(), num_variable_nodes_);
 		output_bits_llr_app().Resize(num_iterations(), num_variable_nodes_);
+		output_bits_packed().Resize(num_iterations(), bit_packing::Num_Words(num_variable_nodes_));
 
 		// Decoder RAMs
 		app_ram_.Resize(dst_parallelism_, num_variable_nodes_ / dst_parallelism_);
@@ -125,6 +193,7 @@ int Decoder_LDPC_IEEE_802_11ad::Run()
 {
 
 	unsigned int pchk_satisfied;
+	unsigned int app_saturation_percent = 0;
 	unsigned int iter = 0;
 	bool next_iter_is_last_iter = false; 
 	bool last_iter = false; 
@@ -135,6 +204,15 @@ int Decoder_LDPC_IEEE_802_11ad::Run()
 	if(param_list_.config_modified())
 		Init();
 
+	// Record this frame into the trace?
+	trace_active_ = (trace_file_ != NULL &&
+	                 (trace_num_frames() == 0 || trace_frames_ < trace_num_frames()));
+	if (trace_active_)
+		trace_frames_++;
+
+	// The condition counters are read and reset after each iteration.
+	Reset_Split_Row_Conditions();
+
 	// Read the channel values and store them in app_ram_.
 	Init_APP_RAM(is_IRA_code_, input_bits_llr(), app_ram_);
 
@@ -162,6 +240,7 @@ int Decoder_LDPC_IEEE_802_11ad::Run()
 		 * hard decoded bits in output_bits buffer.
 		 */
 		Read_APP_RAM(app_ram_, iter, output_bits_llr_app(), output_bits());
+		bit_packing::Pack_Bits(&output_bits()[iter][0], num_variable_nodes_, &output_bits_packed()[iter][0]);
 
 		// Check whether all parity checks were satisfied in the previous iteration.
 		last_iter = next_iter_is_last_iter;
@@ -183,6 +262,21 @@ int Decoder_LDPC_IEEE_802_11ad::Run()
 
 		mean_iterations(iter)().Write(iter);
 
+		// Convergence statistics of this iteration.
+		unsatisfied_checks(iter)().Write(num_check_nodes_ - pchk_satisfied);
+
+		app_saturation_percent = (100 * Calc_Saturated_APP_Values(iter - 1, output_bits_llr_app()) +
+		                          num_variable_nodes_ / 2) / num_variable_nodes_;
+		app_saturation(iter)().Write(app_saturation_percent);
+
+		if (check_node_algorithm_ == SPLIT_ROW ||
+		    check_node_algorithm_ == SPLIT_ROW_IMPROVED ||
+		    check_node_algorithm_ == SPLIT_ROW_SELF_CORRECTING)
+		{
+			for (unsigned int c = 0; c < NUM_SPLIT_ROW_CONDITIONS; c++)
+				split_row_conditions(iter)(c)().Write(split_row_conditions_[c]);
+		}
+		Reset_Split_Row_Conditions();
 
 	/*
 	 * Abort conditions:
@@ -207,9 +301,22 @@ int Decoder_LDPC_IEEE_802_11ad::Run()
 	for(unsigned int i = iter; i < num_iterations(); i++)
 	{
 		mean_iterations(i + 1)().Write(iter);
+		unsatisfied_checks(i + 1)().Write(num_check_nodes_ - pchk_satisfied);
+		app_saturation(i + 1)().Write(app_saturation_percent);
 		output_bits_llr_app()[i] = output_bits_llr_app()[iter - 1];
 		output_bits()[i]         = output_bits()[iter - 1];
+		output_bits_packed()[i]  = output_bits_packed()[iter - 1];
+	}
+
+#ifdef LDPC_PERF_COUNTERS
+	// Accumulated counts since the last configuration.
+	for (unsigned int p = 0; p < Decoder_LDPC_Perf_Counters::NUM_PHASES; p++)
+	{
+		for (unsigned int e = 0; e < Decoder_LDPC_Perf_Counters::NUM_EVENTS; e++)
+			perf_counters(p)(e)().Write(perf_counters_.Count(p, e));
+		perf_ipc(p)().Write(perf_counters_.IPC(p));
 	}
+#endif
 
 	return 0;
 }
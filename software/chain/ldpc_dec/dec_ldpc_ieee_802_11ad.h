@@ -31,15 +31,12 @@ class Decoder_LDPC_IEEE_802_11ad : public Decoder_LDPC_Binary_HW_Interface,
 
 public:
 
-	Decoder_LDPC_IEEE_802_11ad() { };
+	Decoder_LDPC_IEEE_802_11ad() : trace_frames_(0) { };
 	virtual ~Decoder_LDPC_IEEE_802_11ad() { };
 
 	int Run();
 
-private:
-
-	Buffer<int, 2> app_ram_;  ///< APP RAM of LDPC decoder
-	Buffer<int, 2> msg_ram_;  ///< Extrinsic RAM of LDPC Decoder
+protected:
 
 	void Init();
 
@@ -56,6 +53,14 @@ private:
 	 */
 	void Set_LDPC_Parameters();
 
+private:
+
+	Buffer<int, 2> app_ram_;  ///< APP RAM of LDPC decoder
+	Buffer<int, 2> msg_ram_;  ///< Extrinsic RAM of LDPC Decoder
+
+	unsigned int trace_frames_;    ///< Number of frames recorded into the trace file
+	std::string  trace_file_name_; ///< Name of the trace file opened last, see Init()
+
 };
 }
 #endif // DEC_LDPC_IEEE_802_11AD_H_
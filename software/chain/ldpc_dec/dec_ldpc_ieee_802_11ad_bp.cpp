@@ -0,0 +1,420 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Floating-point belief propagation reference decoder for the IEEE 802.11ad standard.
+/// \date   2026/10/19
+//
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+
+#include "dec_ldpc_ieee_802_11ad_bp.h"
+
+using namespace hlp_fct::logging;
+using namespace std;
+
+namespace cse_lib {
+
+void Decoder_LDPC_IEEE_802_11ad_BP::Set_BP_Default_Values()
+{
+	bp_check_node.Link_Value_String(PHI_TABLE, "PHI_TABLE");
+	bp_check_node.Link_Value_String(TANH,      "TANH");
+
+	bp_check_node.Init(PHI_TABLE, "bp_check_node", param_list_);
+	bp_max_llr.Init(30.0, "bp_max_llr", param_list_);
+}
+
+
+void Decoder_LDPC_IEEE_802_11ad_BP::Init()
+{
+	unsigned int num_edges;
+	int vng_select;
+	int shift_value;
+	unsigned int vector_addr;
+
+	// Code parameters and output buffers as for the hardware decoder.
+	Decoder_LDPC_IEEE_802_11ad::Init();
+
+	num_edges = num_check_nodes_ * max_check_degree_;
+
+	try
+	{
+		app_.Resize(num_variable_nodes_);
+		app_prev_.Resize(num_variable_nodes_);
+		channel_.Resize(num_variable_nodes_);
+		msg_.Resize(num_edges);
+		edge_vn_.Resize(num_edges);
+		cn_in_.Resize(max_check_degree_);
+		cn_out_.Resize(max_check_degree_);
+		cn_tmp_.Resize(max_check_degree_);
+	}
+	catch(bad_alloc&)
+	{
+		Msg(ERROR, instance_name(), "Memory allocation failure!");
+		throw;
+	}
+
+	/*
+	 * Map the edges to variable nodes in linear order. Distributing the
+	 * variable node indices like the channel values gives the position of
+	 * each APP RAM entry in the codeword.
+	 */
+	Buffer<int> vn_index(num_variable_nodes_);
+	Buffer<int, 2> vn_ram(dst_parallelism_, num_variable_nodes_ / dst_parallelism_);
+
+	for (unsigned int i = 0; i < num_variable_nodes_; i++)
+		vn_index[i] = i;
+
+	Init_APP_RAM(is_IRA_code_, vn_index, vn_ram);
+
+	for (unsigned int cng_counter = 0; cng_counter < num_check_nodes_ / dst_parallelism_; cng_counter++)
+		for (unsigned int cfu_counter = 0; cfu_counter < dst_parallelism_; cfu_counter++)
+		{
+			unsigned int edge = (cng_counter * dst_parallelism_ + cfu_counter) * max_check_degree_;
+
+			vector_addr = cng_counter * max_check_degree_;
+
+			for (unsigned int i = 0; i < max_check_degree_; i++, vector_addr++, edge++)
+			{
+				vng_select  = addr_vector_[vector_addr];
+				shift_value = shft_vector_[vector_addr];
+
+				// Unused edges and the virtual edge of IRA codes do not take part in decoding.
+				if (vng_select < 0 ||
+				    (is_IRA_code_     &&
+				     cfu_counter == 0 &&
+				     shift_value == (signed) dst_parallelism_ - 1 &&
+				     vng_select  == (signed) (num_variable_nodes_ / dst_parallelism_ - 1)))
+				{
+					edge_vn_[edge] = -1;
+				}
+				else
+				{
+					edge_vn_[edge] = vn_ram[(shift_value + cfu_counter) % dst_parallelism_][vng_select];
+				}
+			}
+		}
+
+	/*
+	 * phi(x) is its own inverse, it is bp_max_llr at phi_min_x_. In between the
+	 * steps are logarithmically spaced: they cover equal ranges of the float
+	 * representation of x. Each step is sampled at its center, all values are
+	 * limited to bp_max_llr.
+	 */
+	if (!(bp_max_llr() >= 1.0f && bp_max_llr() <= 80.0f))
+	{
+		Msg(ERROR, instance_name(), "bp_max_llr has to be in the range 1 ... 80!");
+		throw invalid_argument("\nException[Decoder_LDPC_IEEE_802_11ad_BP]: bp_max_llr out of range!");
+	}
+
+	phi_min_x_    = static_cast<float>(Phi_Exact(bp_max_llr()));
+	phi_min_bits_ = Float_Bits(phi_min_x_);
+	phi_last_     = ((Float_Bits(bp_max_llr()) - phi_min_bits_) >> PHI_SHIFT) + 2;
+
+	try
+	{
+		phi_table_.Resize(phi_last_ + 1);
+	}
+	catch(bad_alloc&)
+	{
+		Msg(ERROR, instance_name(), "Memory allocation failure!");
+		throw;
+	}
+
+	phi_table_[0] = bp_max_llr();
+	for (int i = 1; i < phi_last_; i++)
+	{
+		int bits = phi_min_bits_ + ((i - 1) << PHI_SHIFT) + (1 << (PHI_SHIFT - 1));
+		float x;
+
+		memcpy(&x, &bits, sizeof(x));
+		phi_table_[i] = static_cast<float>(min(Phi_Exact(x), static_cast<double>(bp_max_llr())));
+	}
+	phi_table_[phi_last_] = phi_min_x_;
+
+	param_list_.config_modified(false);
+}
+
+
+double Decoder_LDPC_IEEE_802_11ad_BP::Phi_Exact(double x)
+{
+	if (x < 1.0)
+		return -log(tanh(x / 2.0));
+
+	// 2 * atanh(exp(-x)), the series avoids the cancellation in the log for large x.
+	double e = exp(-x);
+	if (e < 1e-4)
+		return 2.0 * (e + e * e * e / 3.0);
+	return log((1.0 + e) / (1.0 - e));
+}
+
+
+void Decoder_LDPC_IEEE_802_11ad_BP::Check_Node_BP(unsigned int degree)
+{
+	float max_llr = bp_max_llr();
+	float sum = 0.0;
+	bool parity = false;
+	unsigned int i;
+
+	switch(bp_check_node())
+	{
+	case PHI_TABLE:
+	{
+#ifdef __AVX2__
+		const __m256 sign_bit = _mm256_set1_ps(-0.0f);
+		const __m256 zero = _mm256_setzero_ps();
+#endif
+
+		// Magnitudes in log domain and parity of the signs.
+		i = 0;
+#ifdef __AVX2__
+		for (; i + 8 <= degree; i += 8)
+		{
+			__m256 in = _mm256_loadu_ps(&cn_in_[i]);
+
+			_mm256_storeu_ps(&cn_tmp_[i], Phi_AVX2(_mm256_andnot_ps(sign_bit, in)));
+			parity ^= (bit_packing::Popcount(_mm256_movemask_ps(_mm256_cmp_ps(in, zero, _CMP_LT_OQ))) & 1);
+		}
+#endif
+		for (; i < degree; i++)
+		{
+			cn_tmp_[i] = Phi(fabs(cn_in_[i]));
+			parity ^= (cn_in_[i] < 0);
+		}
+
+		// The sum stays sequential, so the messages do not depend on the vector width.
+		for (i = 0; i < degree; i++)
+			sum += cn_tmp_[i];
+
+		// Exclude the own edge, back to LLR domain and apply the sign.
+		i = 0;
+#ifdef __AVX2__
+		__m256 sum_v = _mm256_set1_ps(sum);
+		__m256 parity_v = parity ? sign_bit : zero;
+
+		for (; i + 8 <= degree; i += 8)
+		{
+			__m256 in = _mm256_loadu_ps(&cn_in_[i]);
+			__m256 msg = Phi_AVX2(_mm256_sub_ps(sum_v, _mm256_loadu_ps(&cn_tmp_[i])));
+			__m256 sign = _mm256_and_ps(_mm256_cmp_ps(in, zero, _CMP_LT_OQ), sign_bit);
+
+			_mm256_storeu_ps(&cn_out_[i], _mm256_xor_ps(msg, _mm256_xor_ps(sign, parity_v)));
+		}
+#endif
+		for (; i < degree; i++)
+		{
+			float msg = Phi(sum - cn_tmp_[i]);
+			cn_out_[i] = (parity ^ (cn_in_[i] < 0)) ? -msg : msg;
+		}
+		break;
+	}
+
+	case TANH:
+	{
+		// Forward products of tanh(x/2), the backward products are accumulated on the fly.
+		for (i = 0; i < degree; i++)
+			cn_tmp_[i] = tanh(cn_in_[i] / 2.0f);
+
+		float forward = 1.0;
+		for (i = 0; i < degree; i++)
+		{
+			cn_out_[i] = forward;
+			forward *= cn_tmp_[i];
+		}
+
+		float backward = 1.0;
+		for (i = degree; i-- > 0; )
+		{
+			float prod = cn_out_[i] * backward;
+			backward *= cn_tmp_[i];
+
+			// 2 * atanh(prod), limited to avoid infinite messages.
+			float msg = log((1.0f + prod) / (1.0f - prod));
+			cn_out_[i] = (msg > max_llr) ? max_llr : ((msg < -max_llr || msg != msg) ? -max_llr : msg);
+		}
+		break;
+	}
+	}
+}
+
+
+unsigned int Decoder_LDPC_IEEE_802_11ad_BP::Decode_BP(bool layered)
+{
+	unsigned int ok_checks = 0;
+	unsigned int degree;
+	int vn;
+
+	// For two-phase scheduling all check nodes work on the APP values of the previous iteration.
+	if (!layered)
+	{
+		app_prev_ = app_;
+		app_ = channel_;
+	}
+
+	Buffer<float> &app_in = layered ? app_ : app_prev_;
+
+	for (unsigned int cn = 0; cn < num_check_nodes_; cn++)
+	{
+		unsigned int edge = cn * max_check_degree_;
+		bool parity = false;
+
+		// Gather the check node input of the valid edges.
+		degree = 0;
+		for (unsigned int i = 0; i < max_check_degree_; i++)
+		{
+			vn = edge_vn_[edge + i];
+			if (vn < 0)
+				continue;
+
+			parity ^= (app_in[vn] < 0);
+			cn_in_[degree++] = app_in[vn] - msg_[edge + i];
+		}
+
+		ok_checks += (parity ? 0 : 1);
+
+		Check_Node_BP(degree);
+
+		// Store the new messages and update the APP values.
+		degree = 0;
+		for (unsigned int i = 0; i < max_check_degree_; i++)
+		{
+			vn = edge_vn_[edge + i];
+			if (vn < 0)
+				continue;
+
+			msg_[edge + i] = cn_out_[degree];
+
+			/*
+			 * The APP values are not limited: a saturated APP value together with
+			 * a large message would falsify the extrinsic input of the next check node.
+			 */
+			if (layered)
+				app_[vn] = cn_in_[degree] + cn_out_[degree];
+			else
+				app_[vn] += cn_out_[degree];
+
+			degree++;
+		}
+	}
+
+	return ok_checks;
+}
+
+
+void Decoder_LDPC_IEEE_802_11ad_BP::Read_APP(unsigned int iter)
+{
+	float scale = static_cast<float>(1 << bw_fract_);
+	int value;
+
+	for (unsigned int i = 0; i < num_variable_nodes_; i++)
+	{
+		// Quantize the APP values like the hardware decoder.
+		value = static_cast<int>(floor(app_[i] * scale + 0.5f));
+		Saturate_Value(value, max_msg_app_);
+
+		output_bits_llr_app()[iter][i] = value;
+		output_bits()[iter][i] = (app_[i] < 0 ? 1 : 0);
+	}
+
+	bit_packing::Pack_Bits(&output_bits()[iter][0], num_variable_nodes_, &output_bits_packed()[iter][0]);
+}
+
+
+int Decoder_LDPC_IEEE_802_11ad_BP::Run()
+{
+	unsigned int pchk_satisfied;
+	unsigned int app_saturation_percent = 0;
+	unsigned int iter = 0;
+	bool next_iter_is_last_iter = false;
+	bool last_iter = false;
+
+	decoding_successful().Write(false);
+	num_modified_systematic_bits().Write(0);
+
+	if(param_list_.config_modified())
+		Init();
+
+	// Channel values without quantization of the fractional part.
+	float scale = 1.0f / (1 << bw_fract_);
+	for (unsigned int i = 0; i < num_variable_nodes_; i++)
+		channel_[i] = input_bits_llr()[i] * scale;
+
+	app_ = channel_;
+	msg_.Clear();
+
+	do
+	{
+		// Perform one BP iteration.
+		switch(scheduling())
+		{
+		case LAYERED:
+			pchk_satisfied = Decode_BP(true);
+			break;
+
+		case TWO_PHASE:
+			pchk_satisfied = Decode_BP(false);
+			break;
+
+		default:
+			pchk_satisfied = 0;
+			Msg(ERROR, instance_name(), "Selected scheduling not supported for these codes!");
+			break;
+		}
+
+		Read_APP(iter);
+
+		// Check whether all parity checks were satisfied in the previous iteration.
+		last_iter = next_iter_is_last_iter;
+
+		// Are all parity checks satisfied? Same stopping as the hardware decoder.
+		if (pchk_satisfied == num_check_nodes_)
+		{
+			decoding_successful().Write(true);
+			next_iter_is_last_iter = true;
+		}
+
+		// Store the number of flipped bits
+		if (iter != 0)
+			flipped_bits(iter)().Write(Calc_Flipped_Bits(iter, output_bits()));
+
+		iter++;
+
+		mean_iterations(iter)().Write(iter);
+
+		// Convergence statistics of this iteration.
+		unsatisfied_checks(iter)().Write(num_check_nodes_ - pchk_satisfied);
+
+		app_saturation_percent = (100 * Calc_Saturated_APP_Values(iter - 1, output_bits_llr_app()) +
+		                          num_variable_nodes_ / 2) / num_variable_nodes_;
+		app_saturation(iter)().Write(app_saturation_percent);
+
+	} while (iter < num_iterations() &&
+	         last_iter == false);
+
+	// Write the number of unsatisfied parity checks.
+	num_unsatisfied_parity_checks().Write(num_check_nodes_ - pchk_satisfied);
+
+	// Set number of used iterations in output buffer.
+	iterations_performed().Write(iter);
+
+	// Get statistic about modified bits.
+	num_modified_systematic_bits().Write(Calc_Modified_Systematic_Bits(iter, input_bits_llr(), output_bits()));
+
+	// Fill the output buffer and the status port for the remaining iterations.
+	for(unsigned int i = iter; i < num_iterations(); i++)
+	{
+		mean_iterations(i + 1)().Write(iter);
+		unsatisfied_checks(i + 1)().Write(num_check_nodes_ - pchk_satisfied);
+		app_saturation(i + 1)().Write(app_saturation_percent);
+		output_bits_llr_app()[i] = output_bits_llr_app()[iter - 1];
+		output_bits()[i]         = output_bits()[iter - 1];
+		output_bits_packed()[i]  = output_bits_packed()[iter - 1];
+	}
+
+	return 0;
+}
+}
@@ -0,0 +1,178 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Floating-point belief propagation reference decoder for the IEEE 802.11ad standard.
+/// \date   2026/10/19
+//
+
+#ifndef DEC_LDPC_IEEE_802_11AD_BP_H_
+#define DEC_LDPC_IEEE_802_11AD_BP_H_
+
+#include <cstring>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "dec_ldpc_ieee_802_11ad.h"
+
+
+namespace cse_lib {
+
+/// Floating-point sum-product (BP) reference decoder for the IEEE 802.11ad codes.
+/**
+ * Uses the addressing tables, ports and parameters of the hardware-compliant
+ * decoder, so it can replace Decoder_LDPC_IEEE_802_11ad in a simulation chain
+ * to judge the quantization losses of the hardware decoder. The quantized
+ * channel values are scaled by 2^-bw_fract, the APP output is quantized back
+ * to bw_fract fractional bits and saturated to bw_app bits.
+ * Used parameters: ldpc_code, num_iterations, scheduling (LAYERED or
+ * TWO_PHASE), bw_fract, bw_app. The check node algorithm is selected by
+ * bp_check_node.
+ *
+ * The phi table of the PHI_TABLE check node has logarithmically spaced steps
+ * between phi(bp_max_llr) and bp_max_llr, it is indexed by the upper bits of
+ * the float representation of x. So phi(x) reaches bp_max_llr for small x like
+ * the exact function, and all messages are limited to bp_max_llr as for TANH.
+ * With the -mavx2 flag the check node looks up eight phi values per step by a
+ * gather, the results are the same as without the flag.
+ *
+ * \ingroup modules
+ */
+class Decoder_LDPC_IEEE_802_11ad_BP : public Decoder_LDPC_IEEE_802_11ad
+{
+
+public:
+
+	Decoder_LDPC_IEEE_802_11ad_BP()
+	{
+		instance_name(Unique_ID());
+		Set_BP_Default_Values();
+	}
+
+	virtual ~Decoder_LDPC_IEEE_802_11ad_BP() { };
+
+	/// Unique identification string of the module.
+	static std::string Unique_ID(){ return "Decoder_LDPC_IEEE_802_11ad_BP";}
+
+	int Run();
+
+
+	/// Check node implementations of the BP decoder
+	enum BP_CHECK_NODE_ENUM {
+		PHI_TABLE, /*!< Log domain, sum of phi(x) = -ln(tanh(x/2)) by table lookup */
+		TANH       /*!< Tanh domain, exact boxplus by forward-backward products */
+	};
+
+	/// BP check node implementation
+	Param<BP_CHECK_NODE_ENUM> bp_check_node;
+
+	/// Maximum magnitude of check node messages, range of the phi table, 1 ... 80 (default: 30.0)
+	Param<float> bp_max_llr;
+
+
+private:
+
+	/// The phi table has 2^(23 - PHI_SHIFT) steps per octave of x.
+	enum { PHI_SHIFT = 16 };
+
+	Buffer<float> app_;         ///< APP values in linear order
+	Buffer<float> app_prev_;    ///< APP values of the previous iteration (two-phase scheduling)
+	Buffer<float> channel_;     ///< Channel values in linear order
+	Buffer<float> msg_;         ///< Check node messages, max_check_degree_ for each check node
+	Buffer<int>   edge_vn_;     ///< Variable node of each edge, -1 for unused edges
+	Buffer<float> phi_table_;   ///< bp_max_llr, phi(x) at the center of each step, phi(bp_max_llr)
+	float phi_min_x_;           ///< phi(bp_max_llr), phi(x) is bp_max_llr for x <= phi_min_x_
+	int phi_min_bits_;          ///< Float representation of phi_min_x_
+	int phi_last_;              ///< Last table entry, for x >= bp_max_llr
+
+	Buffer<float> cn_in_;       ///< Check node input, valid edges only
+	Buffer<float> cn_out_;      ///< Check node output, valid edges only
+	Buffer<float> cn_tmp_;      ///< Check node intermediate values
+
+
+	/// Set the BP parameters to their default values.
+	/**
+	 * Default values:
+	 *  - bp_check_node : PHI_TABLE
+	 *  - bp_max_llr    : 30.0
+	 */
+	void Set_BP_Default_Values();
+
+
+	/// Parameterize the decoder and compile the edge table and the phi table.
+	void Init();
+
+
+	/// One BP iteration, returns the number of satisfied parity checks.
+	/**
+	 * \param layered  Update the APP values after each check node (LAYERED)
+	 *                 or after all check nodes (TWO_PHASE).
+	 */
+	unsigned int Decode_BP(bool layered);
+
+
+	/// Check node according to bp_check_node.
+	/**
+	 * Computes for each edge the boxplus of all other edges of cn_in_ and
+	 * stores it in cn_out_.
+	 *
+	 * \param degree  Number of valid edges in cn_in_.
+	 */
+	void Check_Node_BP(unsigned int degree);
+
+
+	/// Float representation of x, it grows with x for positive x.
+	static int Float_Bits(float x)
+	{
+		int bits;
+		memcpy(&bits, &x, sizeof(bits));
+		return bits;
+	}
+
+
+	/// phi(x) = -ln(tanh(x/2)) in double precision, x > 0.
+	static double Phi_Exact(double x);
+
+
+	/// Table lookup of phi(x) = -ln(tanh(x/2)), x >= 0.
+	float Phi(float x)
+	{
+		// Small, zero, negative (rounding errors of sums) and NaN values give bp_max_llr.
+		if (!(x > phi_min_x_))
+			return phi_table_[0];
+
+		if (!(x < bp_max_llr()))
+			return phi_table_[phi_last_];
+
+		return phi_table_[((Float_Bits(x) - phi_min_bits_) >> PHI_SHIFT) + 1];
+	}
+
+#ifdef __AVX2__
+	/// Phi() of eight values (AVX2), same results as Phi().
+	__m256 Phi_AVX2(__m256 x)
+	{
+		__m256i idx = _mm256_sub_epi32(_mm256_castps_si256(x), _mm256_set1_epi32(phi_min_bits_));
+		idx = _mm256_add_epi32(_mm256_srai_epi32(idx, PHI_SHIFT), _mm256_set1_epi32(1));
+
+		// Same cases as Phi(): the last entry from bp_max_llr on, the first one if not x > phi_min_x_.
+		__m256 below_max = _mm256_cmp_ps(x, _mm256_set1_ps(bp_max_llr()), _CMP_LT_OQ);
+		__m256 above_min = _mm256_cmp_ps(x, _mm256_set1_ps(phi_min_x_), _CMP_GT_OQ);
+
+		idx = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(_mm256_set1_epi32(phi_last_)),
+		                                           _mm256_castsi256_ps(idx), below_max));
+		idx = _mm256_and_si256(idx, _mm256_castps_si256(above_min));
+
+		return _mm256_i32gather_ps(&phi_table_[0], idx, sizeof(float));
+	}
+#endif
+
+
+	/// Write APP values and hard decisions of an iteration to the output ports.
+	void Read_APP(unsigned int iter);
+
+};
+}
+#endif // DEC_LDPC_IEEE_802_11AD_BP_H_
@@ -66,6 +66,22 @@ public:
 	/// Extrinsic scaling factor for Min-Sum algorithm
 	Param<float> esf_factor;
 
+	/// Numerator of the extrinsic scaling (used if esf_denominator != 0)
+	Param<unsigned int> esf_numerator;
+
+	/// Denominator of the extrinsic scaling (0: use esf_factor)
+	Param<unsigned int> esf_denominator;
+
+	/// Offset subtracted from the scaled check node output magnitudes (Offset Min-Sum)
+	Param<unsigned int> esf_offset;
+
+	/// Numerator of the extrinsic scaling for each iteration (empty: esf_numerator)
+	/**
+	 * Requires esf_denominator != 0. The last entry applies to all further
+	 * iterations.
+	 */
+	Param<Buffer<unsigned int> > esf_schedule;
+
 	/// Perform parity check on APP values (true) or on extrinsic values (false)
 	Param<bool> app_parity_check;
 
@@ -75,6 +91,49 @@ public:
     /// Threshold for Split Row
     Param<unsigned int> threshold;
 
+    /// Partition of each edge of a check node for Split Row (empty: contiguous partitions)
+    /**
+     * Either one entry per edge of a check node (max_check_degree of the
+     * selected code), used for all check node groups, or one entry per edge for
+     * each check node group. Each entry is the partition index of the edge.
+     * Without a map the first partition takes one more valid edge if the
+     * valid edges are not divisible by num_partitions; a map like
+     * 0 0 1 1 2 2 3 (degree 7, 4 partitions) spreads them evenly instead.
+     */
+    Param<Buffer<unsigned int> > partition_map;
+
+    /// Pairs of partitions that exchange threshold_en and sign (empty: left and right partition)
+    Param<Buffer<unsigned int> > partition_neighbors;
+
+    /// Thresholds of additional decoder variants (threshold sweep in one run)
+    /**
+     * Evaluated by the simulation chain: for each entry one decoder instance
+     * decodes the same channel values with its own error rate statistics.
+     * An empty list (default) only runs the decoder as configured. A list with
+     * a single entry is applied to all variants.
+     */
+    Param<Buffer<unsigned int> > threshold_variants;
+
+    /// Number of partitions of additional decoder variants, see threshold_variants
+    Param<Buffer<unsigned int> > num_partitions_variants;
+
+
+
+	/*************
+	 ** Tracing **
+	 *************/
+
+	/// Binary trace file of the check node data (empty: no trace), see Decoder_LDPC_Binary_HW_Share::Open_Trace()
+	/**
+	 * The file is opened once and holds the frames of all simulation points.
+	 * If decoder parameters of the trace header change, the trace is closed.
+	 * Decoder variants of a chain write to files with the variant suffix.
+	 */
+	Param<raw_string> trace_file;
+
+	/// Number of frames to record into the trace file (0: all frames), counted over all simulation points
+	Param<unsigned int> trace_num_frames;
+
 
 
 	/******************
@@ -123,10 +182,22 @@ protected:
 	 *  - num_iterations   : 10
 	 *  - num_lambda_min   : 3
 	 *  - esf_factor       : 0.875
+	 *  - esf_numerator    : 7
+	 *  - esf_denominator  : 0
+	 *  - esf_offset       : 0
+	 *  - esf_schedule     : (empty)
 	 *  - dec_algorithm    : MIN_SUM
 	 *  - scheduling       : LAYERED
 	 *  - ldpc_code        : IEEE_802_11AD_P42_N672_R050
 	 *  - app_parity_check : true
+	 *  - num_partitions   : 2
+	 *  - threshold        : 16
+	 *  - partition_map           : (empty)
+	 *  - partition_neighbors     : (empty)
+	 *  - trace_file              : (empty)
+	 *  - trace_num_frames        : 1
+	 *  - threshold_variants      : (empty)
+	 *  - num_partitions_variants : (empty)
 	 */
 	void Set_Default_Values()
 	{
@@ -152,9 +223,19 @@ protected:
 		num_iterations.Init(10, "num_iterations", param_list_);
 		num_lambda_min.Init(3, "num_lambda_min", param_list_);
 		esf_factor.Init(0.875, "esf_factor", param_list_);
+		esf_numerator.Init(7, "esf_numerator", param_list_);
+		esf_denominator.Init(0, "esf_denominator", param_list_);
+		esf_offset.Init(0, "esf_offset", param_list_);
+		esf_schedule.Init(Buffer<unsigned int>(), "esf_schedule", param_list_);
 		app_parity_check.Init(true, "app_parity_check", param_list_);
         num_partitions.Init(2, "num_partitions", param_list_);
         threshold.Init(16, "threshold", param_list_);
+        partition_map.Init(Buffer<unsigned int>(), "partition_map", param_list_);
+        partition_neighbors.Init(Buffer<unsigned int>(), "partition_neighbors", param_list_);
+        trace_file.Init("", "trace_file", param_list_);
+        trace_num_frames.Init(1, "trace_num_frames", param_list_);
+        threshold_variants.Init(Buffer<unsigned int>(), "threshold_variants", param_list_);
+        num_partitions_variants.Init(Buffer<unsigned int>(), "num_partitions_variants", param_list_);
 
 //		dec_algorithm.Init(Decoder_LDPC_Binary_HW_Share::MIN_SUM, "dec_algorithm", param_list_);
 		dec_algorithm.Init(Decoder_LDPC_Binary_HW_Share::MIN_SUM_SELF_CORRECTING, "dec_algorithm", param_list_);
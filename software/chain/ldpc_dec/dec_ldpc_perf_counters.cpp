@@ -0,0 +1,121 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Hardware performance counters of the decoder phases
+/// \date   2026/10/19
+//
+
+#include "dec_ldpc_perf_counters.h"
+
+#ifdef LDPC_PERF_COUNTERS
+
+#include <cstring>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+namespace cse_lib {
+
+Decoder_LDPC_Perf_Counters::Decoder_LDPC_Perf_Counters()
+{
+	static const unsigned long long configs[NUM_EVENTS] = {
+		PERF_COUNT_HW_CPU_CYCLES,
+		PERF_COUNT_HW_INSTRUCTIONS,
+		PERF_COUNT_HW_CACHE_MISSES,
+		PERF_COUNT_HW_BRANCH_MISSES
+	};
+
+	group_fd_ = -1;
+	for (unsigned int e = 0; e < NUM_EVENTS; e++)
+		fds_[e] = -1;
+
+	Reset();
+
+	for (unsigned int e = 0; e < NUM_EVENTS; e++)
+	{
+		perf_event_attr attr;
+		memset(&attr, 0, sizeof(attr));
+		attr.size           = sizeof(attr);
+		attr.type           = PERF_TYPE_HARDWARE;
+		attr.config         = configs[e];
+		attr.disabled       = (e == 0) ? 1 : 0;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv     = 1;
+		attr.read_format    = PERF_FORMAT_GROUP;
+
+		fds_[e] = syscall(__NR_perf_event_open, &attr, 0, -1, (e == 0) ? -1 : fds_[0], 0);
+		if (fds_[e] < 0)
+		{
+			for (unsigned int i = 0; i < e; i++)
+				close(fds_[i]);
+			return;
+		}
+	}
+
+	group_fd_ = fds_[0];
+	ioctl(group_fd_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl(group_fd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+
+Decoder_LDPC_Perf_Counters::~Decoder_LDPC_Perf_Counters()
+{
+	if (group_fd_ < 0)
+		return;
+
+	for (unsigned int e = 0; e < NUM_EVENTS; e++)
+		close(fds_[e]);
+}
+
+
+void Decoder_LDPC_Perf_Counters::Reset()
+{
+	memset(start_, 0, sizeof(start_));
+	memset(counts_, 0, sizeof(counts_));
+	started_ = false;
+}
+
+
+bool Decoder_LDPC_Perf_Counters::Read(unsigned long long values[NUM_EVENTS])
+{
+	// PERF_FORMAT_GROUP: number of events followed by their values.
+	unsigned long long data[1 + NUM_EVENTS];
+
+	if (read(group_fd_, data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)))
+		return false;
+
+	for (unsigned int e = 0; e < NUM_EVENTS; e++)
+		values[e] = data[1 + e];
+	return true;
+}
+
+
+const char* Decoder_LDPC_Perf_Counters::Phase_Name(unsigned int phase)
+{
+	switch(phase)
+	{
+	case GATHER:     return "gather";
+	case CHECK_NODE: return "check_node";
+	case SCATTER:    return "scatter";
+	}
+	return "unknown";
+}
+
+
+const char* Decoder_LDPC_Perf_Counters::Event_Name(unsigned int event)
+{
+	switch(event)
+	{
+	case CYCLES:        return "cycles";
+	case INSTRUCTIONS:  return "instructions";
+	case CACHE_MISSES:  return "cache_misses";
+	case BRANCH_MISSES: return "branch_misses";
+	}
+	return "unknown";
+}
+}
+
+#endif // LDPC_PERF_COUNTERS
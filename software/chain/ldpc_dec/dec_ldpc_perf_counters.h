@@ -0,0 +1,119 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Hardware performance counters of the decoder phases
+/// \date   2026/10/19
+//
+
+#ifndef DEC_LDPC_PERF_COUNTERS_H_
+#define DEC_LDPC_PERF_COUNTERS_H_
+
+/*
+ * The counters are only compiled in if LDPC_PERF_COUNTERS is defined (CMake
+ * option LDPC_PERF_COUNTERS). Otherwise the macros below expand to nothing
+ * and the decoder does not contain any trace of them.
+ */
+#ifdef LDPC_PERF_COUNTERS
+
+#define LDPC_PERF_BEGIN(phase) perf_counters_.Begin(Decoder_LDPC_Perf_Counters::phase)
+#define LDPC_PERF_END(phase)   perf_counters_.End(Decoder_LDPC_Perf_Counters::phase)
+
+namespace cse_lib {
+
+/// Hardware performance counters of the gather, check node and scatter phases
+/**
+ * The counters are read with perf_event_open (Linux) as one group, user
+ * space only. Begin() and End() enclose a phase, the difference of the
+ * counters is accumulated for the phase. Each pair costs two read() system
+ * calls, whose kernel part is not counted. If the counters are not
+ * accessible (e.g., kernel.perf_event_paranoid), Available() returns false
+ * and all counts stay zero.
+ */
+class Decoder_LDPC_Perf_Counters
+{
+
+public:
+
+	/// Decoder phases
+	enum PHASE_ENUM {
+		GATHER,     /*!< Get_Check_Node_Input() and parity check */
+		CHECK_NODE, /*!< Check_Node() dispatch */
+		SCATTER,    /*!< Write_Check_Node_Output() */
+		NUM_PHASES
+	};
+
+	/// Counted events
+	enum EVENT_ENUM {
+		CYCLES,
+		INSTRUCTIONS,
+		CACHE_MISSES,
+		BRANCH_MISSES,
+		NUM_EVENTS
+	};
+
+	Decoder_LDPC_Perf_Counters();
+	~Decoder_LDPC_Perf_Counters();
+
+	/// Are the counters accessible?
+	bool Available() { return group_fd_ >= 0; }
+
+	/// Start a phase, it is accounted to the phase given to End().
+	void Begin(PHASE_ENUM)
+	{
+		started_ = (group_fd_ >= 0) && Read(start_);
+	}
+
+	/// End a phase and accumulate its counts.
+	void End(PHASE_ENUM phase)
+	{
+		unsigned long long now[NUM_EVENTS];
+
+		if (!started_ || !Read(now))
+			return;
+
+		for (unsigned int e = 0; e < NUM_EVENTS; e++)
+			counts_[phase][e] += now[e] - start_[e];
+	}
+
+	/// Accumulated count of an event in a phase.
+	unsigned long long Count(unsigned int phase, unsigned int event) { return counts_[phase][event]; }
+
+	/// Instructions per cycle of a phase.
+	double IPC(unsigned int phase)
+	{
+		return counts_[phase][CYCLES] ? static_cast<double>(counts_[phase][INSTRUCTIONS]) / counts_[phase][CYCLES] : 0.0;
+	}
+
+	/// Clear all accumulated counts.
+	void Reset();
+
+	static const char* Phase_Name(unsigned int phase);
+	static const char* Event_Name(unsigned int event);
+
+private:
+
+	/// Read the current values of all events, returns false on failure.
+	bool Read(unsigned long long values[NUM_EVENTS]);
+
+	int group_fd_;                                        ///< Group leader, -1 if not available
+	int fds_[NUM_EVENTS];                                 ///< File descriptors of the events
+	unsigned long long start_[NUM_EVENTS];                ///< Counter values at Begin()
+	bool started_;                                        ///< start_ is valid
+	unsigned long long counts_[NUM_PHASES][NUM_EVENTS];   ///< Accumulated counts
+
+	// Not copyable, the file descriptors are owned.
+	Decoder_LDPC_Perf_Counters(const Decoder_LDPC_Perf_Counters&);
+	Decoder_LDPC_Perf_Counters& operator=(const Decoder_LDPC_Perf_Counters&);
+};
+}
+
+#else
+
+#define LDPC_PERF_BEGIN(phase)
+#define LDPC_PERF_END(phase)
+
+#endif // LDPC_PERF_COUNTERS
+
+#endif // DEC_LDPC_PERF_COUNTERS_H_
@@ -10,8 +10,12 @@
 /// \date   2010/12/02
 //
 
+#include <stdexcept>
+
 #include "enc_ldpc_bin_struct_share.h"
 
+using namespace std;
+
 namespace cse_lib {
 
 
@@ -202,4 +206,192 @@ void Encoder_LDPC_Binary_Struct_Share::Encode_Binary_Lower_Triangular(Buffer<uns
 	}
 }
 
+
+void Encoder_LDPC_Binary_Struct_Share::Encode_Binary_Lower_Triangular_Packed(const Buffer<packed_bit> &input_bits,
+                                                                             Buffer<packed_bit> &output_bits)
+{
+	using bit_packing::word_t;
+
+	u_int num_vngs = k_b_ + m_b_;    // Number of variable node groups.
+	int h_entry;
+
+	blocks_.Resize(num_vngs);
+	blocks_.Clear();
+
+	// The information bits, an incomplete last group is filled with zeros.
+	for (u_int vng = 0; vng * z_ < input_bits.length() && vng < k_b_; vng++)
+		blocks_[vng] = bit_packing::Get_Bits(input_bits.Data_Ptr(), vng * z_,
+		                                     min(z_, input_bits.length() - vng * z_));
+
+	for (u_int cng = 0; cng < m_b_; cng++)
+	{
+		word_t parity_bits = 0;
+
+		// Accumulate the parity bits of the check node group, one circulant per rotation.
+		for (u_int vng = 0; vng < k_b_ + cng; vng++)
+		{
+			h_entry = *(H_ + cng * num_vngs + vng);
+
+			if (h_entry > -1)
+				parity_bits ^= bit_packing::Rotate_Right(blocks_[vng], h_entry, z_);
+		}
+
+		// Undo the shift of the diagonal entry of the current variable node group.
+		u_int current_vng = k_b_ + cng;
+
+		h_entry = *(H_ + cng * num_vngs + current_vng);
+		blocks_[current_vng] = bit_packing::Rotate_Right(parity_bits, z_ - h_entry, z_);
+	}
+
+	for (u_int vng = 0; vng < num_vngs; vng++)
+		bit_packing::Set_Bits(output_bits.Data_Ptr(), vng * z_, z_, blocks_[vng]);
+}
+
+
+void Encoder_LDPC_Binary_Struct_Share::Init_Generator()
+{
+	using bit_packing::word_t;
+	using bit_packing::WORD_BITS;
+
+	u_int num_vngs   = k_b_ + m_b_;
+	u_int num_info   = k_b_ * z_;
+	u_int num_bits   = num_vngs * z_;
+	u_int num_checks = m_b_ * z_;
+	u_int row_words  = bit_packing::Num_Words(num_bits);
+
+	// Expand H_, row cng * z_ + k has its ones at the bits vng * z_ + (k + h) % z_.
+	Buffer<word_t> H_rows(num_checks * row_words);
+	H_rows.Clear();
+
+	for (u_int cng = 0; cng < m_b_; cng++)
+		for (u_int vng = 0; vng < num_vngs; vng++)
+		{
+			int h_entry = *(H_ + cng * num_vngs + vng);
+
+			if (h_entry < 0)
+				continue;
+
+			for (u_int k = 0; k < z_; k++)
+			{
+				u_int col = vng * z_ + (h_entry + k) % z_;
+				H_rows[(cng * z_ + k) * row_words + col / WORD_BITS] ^= 1ULL << (col % WORD_BITS);
+			}
+		}
+
+	/*
+	 * Gauss-Jordan elimination over GF(2), pivots only in the parity
+	 * columns. Afterwards, pivot row r reads
+	 * p[pivot_col[r]] = sum of the information bits of row r.
+	 */
+	Buffer<u_int> pivot_col(num_checks);
+	u_int rank = 0;
+
+	for (u_int col = num_info; col < num_bits && rank < num_checks; col++)
+	{
+		u_int w = col / WORD_BITS;
+		word_t mask = 1ULL << (col % WORD_BITS);
+		u_int pivot = rank;
+
+		while (pivot < num_checks && (H_rows[pivot * row_words + w] & mask) == 0)
+			pivot++;
+
+		// Parity bit without pivot, it is set to zero.
+		if (pivot == num_checks)
+			continue;
+
+		if (pivot != rank)
+			for (u_int i = 0; i < row_words; i++)
+				swap(H_rows[pivot * row_words + i], H_rows[rank * row_words + i]);
+
+		for (u_int r = 0; r < num_checks; r++)
+			if (r != rank && (H_rows[r * row_words + w] & mask) != 0)
+				for (u_int i = 0; i < row_words; i++)
+					H_rows[r * row_words + i] ^= H_rows[rank * row_words + i];
+
+		pivot_col[rank] = col;
+		rank++;
+	}
+
+	// Remaining rows are zero in the parity columns, they must not constrain the information bits.
+	for (u_int r = rank; r < num_checks; r++)
+		for (u_int i = 0; i < row_words; i++)
+			if (H_rows[r * row_words + i] != 0)
+				throw invalid_argument("\nException[Encoder_LDPC_Binary_Struct_Share]: "
+				                       "The parity columns of H have a smaller rank than H, "
+				                       "no systematic generator exists!");
+
+	// Transpose: one column of parity bits per information bit.
+	gen_num_words_ = bit_packing::Num_Words(rank);
+
+	generator_.Resize(num_info * gen_num_words_);
+	gen_parity_.Resize(gen_num_words_);
+	gen_parity_pos_.Resize(rank);
+	generator_.Clear();
+
+	gen_parity_consecutive_ = true;
+	for (u_int r = 0; r < rank; r++)
+	{
+		const word_t *row = &H_rows[r * row_words];
+
+		for (u_int j = 0; j < num_info; j++)
+			if ((row[j / WORD_BITS] >> (j % WORD_BITS)) & 1)
+				generator_[j * gen_num_words_ + r / WORD_BITS] |= 1ULL << (r % WORD_BITS);
+
+		gen_parity_pos_[r] = pivot_col[r];
+		if (pivot_col[r] != num_info + r)
+			gen_parity_consecutive_ = false;
+	}
+}
+
+
+void Encoder_LDPC_Binary_Struct_Share::Encode_Binary_Generator(const Buffer<packed_bit> &input_bits,
+                                                               Buffer<packed_bit> &output_bits)
+{
+	using bit_packing::word_t;
+	using bit_packing::WORD_BITS;
+
+	u_int num_info  = min(k_b_ * z_, input_bits.length());
+	u_int num_words = bit_packing::Num_Words(num_info);
+	u_int rank      = gen_parity_pos_.length();
+	word_t *parity  = (gen_num_words_ > 0) ? &gen_parity_[0] : NULL;
+
+	for (u_int i = 0; i < gen_num_words_; i++)
+		parity[i] = 0;
+
+	output_bits.Clear();
+
+	for (u_int w = 0; w < num_words; w++)
+	{
+		word_t info = input_bits.Word(w);
+
+		if (w == num_words - 1)
+			info &= bit_packing::Last_Word_Mask(num_info);
+
+		output_bits.Word(w) = info;
+
+		// Add the parity column of each information bit that is one.
+		while (parity != NULL && info != 0)
+		{
+			const word_t *column = &generator_[(w * WORD_BITS + bit_packing::Count_Trailing_Zeros(info)) * gen_num_words_];
+
+			for (u_int i = 0; i < gen_num_words_; i++)
+				parity[i] ^= column[i];
+
+			info &= info - 1;
+		}
+	}
+
+	if (gen_parity_consecutive_)
+	{
+		for (u_int i = 0; i < gen_num_words_; i++)
+			bit_packing::Set_Bits(output_bits.Data_Ptr(), k_b_ * z_ + i * WORD_BITS,
+			                      min(WORD_BITS, rank - i * WORD_BITS), parity[i]);
+	}
+	else
+	{
+		for (u_int r = 0; r < rank; r++)
+			output_bits.Set(gen_parity_pos_[r], (parity[r / WORD_BITS] >> (r % WORD_BITS)) & 1);
+	}
+}
+
 }
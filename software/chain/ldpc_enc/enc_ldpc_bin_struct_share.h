@@ -27,7 +27,7 @@ class Encoder_LDPC_Binary_Struct_Share
 
 protected:
 
-	Encoder_LDPC_Binary_Struct_Share() { }
+	Encoder_LDPC_Binary_Struct_Share() : gen_num_words_(0), gen_parity_consecutive_(false) { }
 	virtual ~Encoder_LDPC_Binary_Struct_Share() { }
 
 
@@ -69,7 +69,9 @@ protected:
 	 * H_ are assumed to be cyclic right shifts (adapt H_ when standard
 	 * defines right shifts).
 	 * The function requires H_ to contain only the information nodes and the
-	 * first parity node group.
+	 * first parity node group. Not all codes of this kind are handled
+	 * correctly (e.g. WiMax rate 3/4B), use Encode_Binary_Generator() for
+	 * those.
 	 */
 	void Encode_Binary_Struct(Buffer<unsigned int> &input_bits,
 	                          Buffer<unsigned int> &output_bits);
@@ -85,6 +87,71 @@ protected:
 	 */
 	void Encode_Binary_Lower_Triangular(Buffer<unsigned int> &input_bits,
 	                                    Buffer<unsigned int> &output_bits);
+
+
+	/// Word-parallel version of Encode_Binary_Lower_Triangular() on packed bits.
+	/**
+	 * The z_ bits of a submatrix are kept in one 64 bit word, so every
+	 * circulant of H_ is applied with one cyclic rotation of a word and the
+	 * parity is accumulated with XOR. Requires z_ <= 64, see
+	 * Packed_Encoding_Possible(). The result is identical to the one of
+	 * Encode_Binary_Lower_Triangular(). output_bits has to hold
+	 * (k_b_ + m_b_) * z_ bits.
+	 */
+	void Encode_Binary_Lower_Triangular_Packed(const Buffer<packed_bit> &input_bits,
+	                                           Buffer<packed_bit> &output_bits);
+
+
+	/// Does a submatrix fit into one word of the packed encoder functions?
+	bool Packed_Encoding_Possible() const { return z_ <= bit_packing::WORD_BITS; }
+
+
+	/// Derive the systematic generator of H_ for Encode_Binary_Generator().
+	/**
+	 * Works for any structured code, no lower triangular or dual diagonal
+	 * parity part is required. H_ has to be complete (m_b_ x (k_b_ + m_b_)
+	 * entries, like for Encode_Binary_Lower_Triangular()). The expanded
+	 * parity check matrix is brought into reduced row echelon form over GF(2)
+	 * with the pivots taken from the parity columns only, so the information
+	 * bits stay at the first k_b_ * z_ positions. Parity columns without pivot
+	 * (rank deficient H_) are set to zero. Throws if the information bits
+	 * cannot be chosen freely, i.e., the parity columns of H_ have a smaller
+	 * rank than H_ itself.
+	 *
+	 * Has to be called again whenever H_, k_b_, m_b_ or z_ change.
+	 */
+	void Init_Generator();
+
+
+	/// Encoder function for arbitrary structured LDPC codes on packed bits.
+	/**
+	 * Uses the generator of Init_Generator(): for every information bit that
+	 * is one, its column of parity bits is added to the parity with packed
+	 * word XORs. The cost is about k * m / 128 word operations per code word,
+	 * independent of the structure of H_.
+	 */
+	void Encode_Binary_Generator(const Buffer<packed_bit> &input_bits,
+	                             Buffer<packed_bit> &output_bits);
+
+private:
+
+	/// Submatrices of the code word for the packed encoder functions, one per word
+	Buffer<bit_packing::word_t> blocks_;
+
+	/// Parity bits depending on each information bit, gen_num_words_ words per information bit
+	Buffer<bit_packing::word_t> generator_;
+
+	/// Code word position of each parity bit of generator_
+	Buffer<u_int> gen_parity_pos_;
+
+	/// Accumulated parity bits of Encode_Binary_Generator()
+	Buffer<bit_packing::word_t> gen_parity_;
+
+	/// Number of words per information bit in generator_
+	u_int gen_num_words_;
+
+	/// Are the parity bits at the consecutive positions k_b_ * z_, k_b_ * z_ + 1, ...?
+	bool gen_parity_consecutive_;
 };
 }
 #endif // ENC_LDPC_BIN_STRUCT_H_
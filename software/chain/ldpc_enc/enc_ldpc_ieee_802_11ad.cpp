@@ -24,11 +24,25 @@ void Encoder_LDPC_IEEE_802_11ad::Init()
 	// Parameterize Encoder
 	Set_LDPC_Code_Parameters();
 
+	if (encoding() == GENERATOR)
+	{
+		try
+		{
+			Init_Generator();
+		}
+		catch(invalid_argument&)
+		{
+			Msg(ERROR, instance_name(), "No systematic generator for this code!");
+			throw;
+		}
+	}
+
 	// Resize output buffer
 	try
 	{
 		// output memory corresponds to codeword size
 		output_bits().Resize((k_b_ + m_b_) * z_);
+		output_bits_packed().Resize((k_b_ + m_b_) * z_);
 	}
 	catch(bad_alloc&)
 	{
@@ -86,7 +100,32 @@ int Encoder_LDPC_IEEE_802_11ad::Run()
 	if(param_list_.config_modified())
 		Init();
 
-	Encode_Binary_Lower_Triangular(input_bits(), output_bits());
+	/*
+	 * All 802.11ad codes have z = 42, so each submatrix is encoded as one
+	 * word. The unpacked code word is derived from the packed one.
+	 */
+	if (encoding() == GENERATOR || Packed_Encoding_Possible())
+	{
+		const Buffer<packed_bit> *packed_input = &input_bits_packed();
+
+		if (packed_input->length() == 0)
+		{
+			packed_input_.Pack(input_bits());
+			packed_input = &packed_input_;
+		}
+
+		if (encoding() == GENERATOR)
+			Encode_Binary_Generator(*packed_input, output_bits_packed());
+		else
+			Encode_Binary_Lower_Triangular_Packed(*packed_input, output_bits_packed());
+
+		output_bits_packed().Unpack(output_bits());
+	}
+	else
+	{
+		Encode_Binary_Lower_Triangular(input_bits(), output_bits());
+		output_bits_packed().Pack(output_bits());
+	}
 
 	return 0;
 }
@@ -31,16 +31,29 @@ class Encoder_LDPC_IEEE_802_11ad : public Encoder_Interface,
 
 public:
 
-	Encoder_LDPC_IEEE_802_11ad() { };
+	Encoder_LDPC_IEEE_802_11ad()
+	{
+		input_bits_packed.Register("input_bits_packed", input_data_list_);
+		output_bits_packed.Register("output_bits_packed", output_data_list_);
+	};
 	virtual ~Encoder_LDPC_IEEE_802_11ad() { };
 
 	int Run();
 
+	/// Information bits packed into 64 bit words, replaces input_bits if connected
+	Data_In<packed_bit> input_bits_packed;
+
+	/// Code bits of output_bits, packed into 64 bit words
+	Data_Out<packed_bit> output_bits_packed;
+
 private:
 
 	void Init();
 	void Set_LDPC_Code_Parameters();
 
+	/// input_bits packed, if input_bits_packed is not connected
+	Buffer<packed_bit> packed_input_;
+
 };
 }
 #endif // ENC_LDPC_IEEE_802_11AD_H_
@@ -55,6 +55,16 @@ public:
 	/// Selects LDPC code
 	Param<LDPC_CODE> ldpc_code;
 
+	/// Encoding methods
+	enum ENCODING_ENUM
+	{
+		LOWER_TRIANGULAR, /*!< Back substitution on the lower triangular parity part of H */
+		GENERATOR         /*!< Systematic generator derived from H at Init(), works for any H */
+	};
+
+	/// Selects the encoding method, both give the same code words
+	Param<ENCODING_ENUM> encoding;
+
 
 protected:
 
@@ -67,6 +77,7 @@ protected:
 	/**
 	 * Default values:
 	 *  - ldpc_code      : IEEE_802_11AD_P42_N672_R050
+	 *  - encoding       : LOWER_TRIANGULAR
 	 */
 	void Set_Default_Values()
 	{
@@ -75,6 +86,10 @@ protected:
 		ldpc_code.Link_Value_String(IEEE_802_11AD_P42_N672_R062, "IEEE_802_11AD_P42_N672_R062");
 		ldpc_code.Link_Value_String(IEEE_802_11AD_P42_N672_R075, "IEEE_802_11AD_P42_N672_R075");
 		ldpc_code.Link_Value_String(IEEE_802_11AD_P42_N672_R081, "IEEE_802_11AD_P42_N672_R081");
+
+		encoding.Init(LOWER_TRIANGULAR, "encoding", param_list_);
+		encoding.Link_Value_String(LOWER_TRIANGULAR, "LOWER_TRIANGULAR");
+		encoding.Link_Value_String(GENERATOR,        "GENERATOR");
 	}
 
 };
@@ -0,0 +1,177 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Confidence intervals of error rates
+/// \date   2026/10/19
+//
+
+#ifndef CONFIDENCE_INTERVAL_H_
+#define CONFIDENCE_INTERVAL_H_
+
+#include <cmath>
+#include <algorithm>
+
+#include "cse_lib.h"
+
+
+namespace cse_lib {
+
+/// Two-sided quantile of the standard normal distribution.
+/**
+ * Returns z with P(-z <= X <= z) = confidence, found by bisection of the
+ * normal distribution function.
+ *
+ * \param confidence Confidence level, e.g. 0.95.
+ */
+inline double Normal_Quantile(double confidence)
+{
+	double p = 0.5 + confidence / 2.0;
+	double lower = 0.0;
+	double upper = 40.0;
+
+	for (unsigned int i = 0; i < 100; i++)
+	{
+		double z = (lower + upper) / 2.0;
+		if (0.5 * erfc(- z / sqrt(2.0)) < p)
+			lower = z;
+		else
+			upper = z;
+	}
+	return (lower + upper) / 2.0;
+}
+
+
+/// Wilson score interval of an error rate.
+/**
+ * \param errors     Number of errors.
+ * \param trials     Number of trials, the interval is [0, 1] if there are none.
+ * \param confidence Confidence level, e.g. 0.95.
+ * \param lower      Lower bound of the interval.
+ * \param upper      Upper bound of the interval.
+ */
+inline void Wilson_Interval(ull_int errors, ull_int trials, double confidence, double& lower, double& upper)
+{
+	if (trials == 0)
+	{
+		lower = 0.0;
+		upper = 1.0;
+		return;
+	}
+
+	double z = Normal_Quantile(confidence);
+	double n = static_cast<double>(trials);
+	double p = errors / n;
+	double denominator = 1.0 + z * z / n;
+	double center = (p + z * z / (2.0 * n)) / denominator;
+	double half_width = z * sqrt(p * (1.0 - p) / n + z * z / (4.0 * n * n)) / denominator;
+
+	lower = (errors == 0)      ? 0.0 : center - half_width;
+	upper = (errors == trials) ? 1.0 : center + half_width;
+}
+
+
+/// Normal interval of an estimated error rate, e.g. of importance sampling.
+/**
+ * \param rate       Estimated error rate.
+ * \param variance   Variance of the estimate.
+ * \param confidence Confidence level, e.g. 0.95.
+ * \param lower      Lower bound of the interval, at least 0.
+ * \param upper      Upper bound of the interval.
+ */
+inline void Normal_Interval(double rate, double variance, double confidence, double& lower, double& upper)
+{
+	double half_width = Normal_Quantile(confidence) * sqrt(variance);
+
+	lower = std::max(0.0, rate - half_width);
+	upper = rate + half_width;
+}
+
+
+
+/// Regularized incomplete beta function I_x(a, b).
+/**
+ * Evaluated by the continued fraction expansion (modified Lentz's method),
+ * using the symmetry I_x(a, b) = 1 - I_(1-x)(b, a) for fast convergence.
+ */
+inline double Incomplete_Beta(double x, double a, double b)
+{
+	if (x <= 0.0)
+		return 0.0;
+	if (x >= 1.0)
+		return 1.0;
+
+	if (x > (a + 1.0) / (a + b + 2.0))
+		return 1.0 - Incomplete_Beta(1.0 - x, b, a);
+
+	const double tiny = 1e-300;
+	double front = exp(lgamma(a + b) - lgamma(a) - lgamma(b) + a * log(x) + b * log(1.0 - x)) / a;
+	double c = 1.0;
+	double d = 1.0 - (a + b) * x / (a + 1.0);
+	if (fabs(d) < tiny)
+		d = tiny;
+	d = 1.0 / d;
+	double f = d;
+
+	for (unsigned int m = 1; m <= 300; m++)
+	{
+		// Even and odd step of the continued fraction.
+		for (unsigned int odd = 0; odd < 2; odd++)
+		{
+			double numerator = odd ? - (a + m) * (a + b + m) * x / ((a + 2.0 * m) * (a + 2.0 * m + 1.0))
+			                       : m * (b - m) * x / ((a + 2.0 * m - 1.0) * (a + 2.0 * m));
+			d = 1.0 + numerator * d;
+			if (fabs(d) < tiny)
+				d = tiny;
+			c = 1.0 + numerator / c;
+			if (fabs(c) < tiny)
+				c = tiny;
+			d = 1.0 / d;
+			f *= c * d;
+		}
+		if (fabs(c * d - 1.0) < 1e-12)
+			break;
+	}
+	return front * f;
+}
+
+
+/// Inverse of the regularized incomplete beta function in x, found by bisection.
+inline double Incomplete_Beta_Inverse(double p, double a, double b)
+{
+	double lower = 0.0;
+	double upper = 1.0;
+
+	for (unsigned int i = 0; i < 60; i++)
+	{
+		double x = (lower + upper) / 2.0;
+		if (Incomplete_Beta(x, a, b) < p)
+			lower = x;
+		else
+			upper = x;
+	}
+	return (lower + upper) / 2.0;
+}
+
+
+/// Clopper-Pearson (exact binomial) interval of an error rate.
+/**
+ * \param errors     Number of errors.
+ * \param trials     Number of trials, the interval is [0, 1] if there are none.
+ * \param confidence Confidence level, e.g. 0.95.
+ * \param lower      Lower bound of the interval.
+ * \param upper      Upper bound of the interval.
+ */
+inline void Clopper_Pearson_Interval(ull_int errors, ull_int trials, double confidence, double& lower, double& upper)
+{
+	double alpha = 1.0 - confidence;
+	double k = static_cast<double>(errors);
+	double n = static_cast<double>(trials);
+
+	lower = (errors == 0)      ? 0.0 : Incomplete_Beta_Inverse(alpha / 2.0, k, n - k + 1.0);
+	upper = (errors >= trials) ? 1.0 : Incomplete_Beta_Inverse(1.0 - alpha / 2.0, k + 1.0, n - k);
+}
+
+}
+#endif // CONFIDENCE_INTERVAL_H_
@@ -0,0 +1,131 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Run time measurement of the chain modules
+/// \date   2026/10/19
+//
+
+#include <ctime>
+
+#include "module_timing.h"
+
+using namespace std;
+
+namespace cse_lib {
+
+Module_Timing::~Module_Timing()
+{
+	for (unsigned int i = 0; i < modules_.size(); i++)
+	{
+		delete modules_[i].run_time;
+		delete modules_[i].num_calls;
+		delete modules_[i].num_frames;
+		delete modules_[i].time_per_frame;
+	}
+}
+
+
+ull_int Module_Timing::Read_Monotonic()
+{
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<ull_int>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+
+ull_int Module_Timing::Read_TSC()
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	unsigned int low, high;
+	__asm__ __volatile__ ("rdtsc" : "=a" (low), "=d" (high));
+	return (static_cast<ull_int>(high) << 32) | low;
+#else
+	return Read_Monotonic();
+#endif
+}
+
+
+void Module_Timing::Init()
+{
+	ticks_per_second_ = 1e9;
+
+	// Calibrate the time stamp counter over 10 ms.
+	if (timer() == RDTSC)
+	{
+		ull_int start_ns  = Read_Monotonic();
+		ull_int start_tsc = Read_TSC();
+		ull_int now_ns;
+
+		do
+			now_ns = Read_Monotonic();
+		while (now_ns - start_ns < 10000000ULL);
+
+		ticks_per_second_ = (Read_TSC() - start_tsc) * 1e9 / (now_ns - start_ns);
+	}
+
+	param_list_.config_modified(false);
+}
+
+
+unsigned int Module_Timing::Module_Id(const string &name)
+{
+	for (unsigned int i = 0; i < modules_.size(); i++)
+		if (modules_[i].name == name)
+			return i;
+
+	Timed_Module timed;
+	timed.name   = name;
+	timed.ticks  = 0;
+	timed.calls  = 0;
+	timed.frames = 0;
+
+	timed.run_time       = new Status_Out<double>;
+	timed.num_calls      = new Status_Out<ull_int>;
+	timed.num_frames     = new Status_Out<ull_int>;
+	timed.time_per_frame = new Status_Out<double>;
+
+	timed.run_time->Register(name + "_run_time", status_out_list_);
+	timed.num_calls->Register(name + "_calls", status_out_list_);
+	timed.num_frames->Register(name + "_frames", status_out_list_);
+	timed.time_per_frame->Register(name + "_time_per_frame", status_out_list_);
+
+	modules_.push_back(timed);
+	return modules_.size() - 1;
+}
+
+
+void Module_Timing::Reset()
+{
+	if (param_list_.config_modified())
+		Init();
+
+	for (unsigned int i = 0; i < modules_.size(); i++)
+	{
+		modules_[i].ticks  = 0;
+		modules_[i].calls  = 0;
+		modules_[i].frames = 0;
+	}
+}
+
+
+int Module_Timing::Run()
+{
+	if (param_list_.config_modified())
+		Init();
+
+	for (unsigned int i = 0; i < modules_.size(); i++)
+	{
+		Timed_Module &timed = modules_[i];
+		double seconds = timed.ticks / ticks_per_second_;
+
+		(*timed.run_time)().Write(seconds);
+		(*timed.num_calls)().Write(timed.calls);
+		(*timed.num_frames)().Write(timed.frames);
+		(*timed.time_per_frame)().Write(timed.frames ? seconds * 1e6 / timed.frames : 0.0);
+	}
+
+	return 0;
+}
+}
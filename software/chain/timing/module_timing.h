@@ -0,0 +1,112 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Run time measurement of the chain modules
+/// \date   2026/10/19
+//
+
+#ifndef MODULE_TIMING_H_
+#define MODULE_TIMING_H_
+
+#include <string>
+#include <vector>
+
+#include "module_timing_iface.h"
+#include "module_timing_param.h"
+
+
+namespace cse_lib {
+
+/// Run time measurement of the Run() calls of the chain modules
+/**
+ * The chain calls the modules through Run_Module(), which measures the time
+ * of the Run() call if the measurement is enabled and only calls Run()
+ * otherwise. For each measured module the accumulated time, the number of
+ * calls and the number of processed frames are kept. Run() writes them to the
+ * status ports, so they can be inserted into the results like the values of
+ * any other module:
+ *  - <module>_run_time       : accumulated time in seconds
+ *  - <module>_calls          : number of Run() calls
+ *  - <module>_frames         : number of processed frames
+ *  - <module>_time_per_frame : time per frame in microseconds
+ *
+ * \ingroup modules
+ */
+class Module_Timing : public Module_Timing_Interface,
+                      public Module_Timing_Parameter
+{
+
+public:
+
+	Module_Timing() : ticks_per_second_(1e9) { }
+
+	virtual ~Module_Timing();
+
+	/// Write the accumulated values to the status ports.
+	int Run();
+
+	/// Id of a measured module, creates the status ports for a new name.
+	unsigned int Module_Id(const std::string &name);
+
+	/// Clear the accumulated values of all modules, call at the start of each simulation point.
+	void Reset();
+
+	/// Call module.Run() and measure its run time if enabled.
+	/**
+	 * \param module  Module to run.
+	 * \param id      Id of the module, see Module_Id().
+	 * \param frames  Number of frames the call processes.
+	 *
+	 * \return Return value of module.Run().
+	 */
+	template <class T> int Run_Module(T &module, unsigned int id, unsigned int frames = 1)
+	{
+		if (!enabled())
+			return module.Run();
+
+		ull_int start = Now();
+		int result = module.Run();
+		Timed_Module &timed = modules_[id];
+		timed.ticks  += Now() - start;
+		timed.calls  += 1;
+		timed.frames += frames;
+		return result;
+	}
+
+private:
+
+	/// Accumulated values and status ports of a measured module
+	struct Timed_Module
+	{
+		std::string name;
+		ull_int ticks;
+		ull_int calls;
+		ull_int frames;
+		Status_Out<double>  *run_time;
+		Status_Out<ull_int> *num_calls;
+		Status_Out<ull_int> *num_frames;
+		Status_Out<double>  *time_per_frame;
+	};
+
+	/// Measure the rate of the time source.
+	void Init();
+
+	/// Current value of the time source in ticks.
+	ull_int Now()
+	{
+		return (timer() == RDTSC) ? Read_TSC() : Read_Monotonic();
+	}
+
+	/// Monotonic clock in nanoseconds.
+	static ull_int Read_Monotonic();
+
+	/// Time stamp counter, falls back to Read_Monotonic() on other CPUs.
+	static ull_int Read_TSC();
+
+	std::vector<Timed_Module> modules_;
+	double ticks_per_second_;
+};
+}
+#endif // MODULE_TIMING_H_
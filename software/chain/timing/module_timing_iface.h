@@ -0,0 +1,36 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Interface of the run time measurement of the chain modules
+/// \date   2026/10/19
+//
+
+#ifndef MODULE_TIMING_IFACE_H_
+#define MODULE_TIMING_IFACE_H_
+
+#include "../modules/base/base_iface.h"
+
+
+namespace cse_lib {
+
+/// Interface of the run time measurement
+/**
+ * The module has no data ports. Its status ports are created for each
+ * measured module, see Module_Timing::Module_Id().
+ *
+ * \ingroup interface
+ */
+class Module_Timing_Interface : public Base_Interface
+{
+
+public:
+
+	Module_Timing_Interface() { }
+
+	virtual ~Module_Timing_Interface() { }
+
+};
+}
+#endif // MODULE_TIMING_IFACE_H_
@@ -0,0 +1,81 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Parameters of the run time measurement of the chain modules
+/// \date   2026/10/19
+//
+
+#ifndef MODULE_TIMING_PARAM_H_
+#define MODULE_TIMING_PARAM_H_
+
+#include "cse_lib.h"
+
+
+namespace cse_lib {
+
+/// Parameter class of the run time measurement
+/**
+ * \ingroup parameter
+ */
+class Module_Timing_Parameter : public Base_Parameter
+{
+
+public:
+
+	Module_Timing_Parameter()
+	{
+		instance_name(Unique_ID());
+		Set_Default_Values();
+	}
+
+	virtual ~Module_Timing_Parameter(){}
+
+	/// Unique identification string of the module.
+	static std::string Unique_ID(){ return "Module_Timing";}
+
+
+	/**************
+	 * Parameters *
+	 **************/
+
+	/// Time sources
+	enum TIMER_ENUM
+	{
+		MONOTONIC, /*!< clock_gettime(CLOCK_MONOTONIC) */
+		RDTSC      /*!< Time stamp counter of x86 CPUs, calibrated against MONOTONIC */
+	};
+
+	/// Measure the run time of the modules.
+	Param<bool> enabled;
+
+	/// Time source of the measurement
+	Param<TIMER_ENUM> timer;
+
+
+protected:
+
+
+	/******************
+	 * Default values *
+	 ******************/
+
+	/// Set all parameters to their default values.
+	/**
+	 * Default values:
+	 *  - enabled : false
+	 *  - timer   : MONOTONIC
+	 */
+	void Set_Default_Values()
+	{
+		timer.Link_Value_String(MONOTONIC, "MONOTONIC");
+		timer.Link_Value_String(RDTSC,     "RDTSC");
+
+		enabled.Init(false, "enabled", param_list_);
+		timer.Init(MONOTONIC, "timer", param_list_);
+	}
+
+};
+}
+#endif // MODULE_TIMING_PARAM_H_
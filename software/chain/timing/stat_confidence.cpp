@@ -0,0 +1,197 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Confidence-based stopping criterion of a simulation point
+/// \date   2026/10/19
+//
+
+#include <ctime>
+#include <cmath>
+#include <algorithm>
+
+#include "stat_confidence.h"
+#include "confidence_interval.h"
+
+using namespace std;
+
+namespace cse_lib {
+
+Statistics_Confidence::Statistics_Confidence()
+{
+	Reset();
+}
+
+
+double Statistics_Confidence::Read_Time()
+{
+	timespec ts;
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+		return 0.0;
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+void Statistics_Confidence::Reset()
+{
+	start_time_        = Read_Time();
+	frames_            = 0;
+	frame_errors_      = 0;
+	weighted_          = false;
+	fer_               = 0.0;
+	fer_variance_      = 0.0;
+	eval_frames_       = 0;
+	eval_frame_errors_ = 0;
+	stop_              = false;
+	stop_reason_       = STOP_LIMITS;
+}
+
+
+double Statistics_Confidence::Error_Rate() const
+{
+	if (weighted_)
+		return fer_;
+	return (frames_ > 0) ? static_cast<double>(frame_errors_) / frames_ : 0.0;
+}
+
+
+void Statistics_Confidence::Calc_Interval(double& lower, double& upper)
+{
+	if (weighted_)
+	{
+		Normal_Interval(fer_, fer_variance_, confidence(), lower, upper);
+		return;
+	}
+
+	switch(interval())
+	{
+	case CLOPPER_PEARSON:
+		Clopper_Pearson_Interval(frame_errors_, frames_, confidence(), lower, upper);
+		break;
+
+	case WILSON:
+	default:
+		Wilson_Interval(frame_errors_, frames_, confidence(), lower, upper);
+		break;
+	}
+}
+
+
+bool Statistics_Confidence::Check(ull_int frames, ull_int frame_errors)
+{
+	frames_       = frames;
+	frame_errors_ = frame_errors;
+	weighted_     = false;
+
+	return Check_Stop();
+}
+
+
+bool Statistics_Confidence::Check_Weighted(ull_int frames, ull_int frame_errors, double fer, double fer_variance)
+{
+	frames_       = frames;
+	frame_errors_ = frame_errors;
+	weighted_     = true;
+	fer_          = fer;
+	fer_variance_ = fer_variance;
+
+	return Check_Stop();
+}
+
+
+bool Statistics_Confidence::Check_Stop()
+{
+	if (!enabled())
+		return false;
+
+	if (stop_)
+		return true;
+
+	if (time_budget() > 0 && Read_Time() - start_time_ >= time_budget())
+	{
+		stop_ = true;
+		stop_reason_ = STOP_TIME_BUDGET;
+		return true;
+	}
+
+	if (frame_errors_ == 0 || frame_errors_ < min_num_diff_blocks())
+		return false;
+
+	// The interval changes slowly, evaluate it on new errors or 1% more frames only.
+	if (frame_errors_ == eval_frame_errors_ && frames_ < eval_frames_ + eval_frames_ / 100)
+		return false;
+
+	eval_frames_       = frames_;
+	eval_frame_errors_ = frame_errors_;
+
+	double lower, upper;
+	Calc_Interval(lower, upper);
+
+	if (upper - lower <= max_relative_width() * Error_Rate())
+	{
+		stop_ = true;
+		stop_reason_ = STOP_PRECISION;
+	}
+
+	return stop_;
+}
+
+
+double Statistics_Confidence::Remaining_Frames()
+{
+	if (!enabled())
+		return -1.0;
+
+	if (stop_)
+		return 0.0;
+
+	double fer = Error_Rate();
+
+	if (frame_errors_ == 0 || fer <= 0 || max_relative_width() <= 0)
+		return -1.0;
+
+	double lower, upper;
+	Calc_Interval(lower, upper);
+
+	// The width shrinks with the square root of the number of frames at a constant FER.
+	double relative_width = (upper - lower) / fer;
+	double frames = static_cast<double>(frames_);
+	double needed = frames * (relative_width / max_relative_width()) * (relative_width / max_relative_width());
+
+	// The interval is not checked before min_num_diff_blocks errors.
+	needed = max(needed, frames * min_num_diff_blocks() / frame_errors_);
+
+	return max(0.0, needed - frames);
+}
+
+
+double Statistics_Confidence::Remaining_Time()
+{
+	if (!enabled() || time_budget() <= 0)
+		return -1.0;
+
+	return max(0.0, time_budget() - (Read_Time() - start_time_));
+}
+
+
+int Statistics_Confidence::Run()
+{
+	double lower, upper;
+	double fer = Error_Rate();
+
+	Calc_Interval(lower, upper);
+
+	num_total_blocks().Write(frames_);
+	num_diff_blocks().Write(frame_errors_);
+	error_rate_blocks().Write(fer);
+	error_rate_blocks_lower().Write(lower);
+	error_rate_blocks_upper().Write(upper);
+
+	// The relative width is undefined without errors.
+	relative_width().Write(fer > 0 ? (upper - lower) / fer : -1.0);
+	stop_reason().Write(stop_reason_);
+
+	return 0;
+}
+}
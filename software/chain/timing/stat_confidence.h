@@ -0,0 +1,124 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Confidence-based stopping criterion of a simulation point
+/// \date   2026/10/19
+//
+
+#ifndef STAT_CONFIDENCE_H_
+#define STAT_CONFIDENCE_H_
+
+#include "stat_confidence_iface.h"
+#include "stat_confidence_param.h"
+
+
+namespace cse_lib {
+
+/// Stopping of a simulation point on the precision of the frame error rate
+/**
+ * Complements the fixed limits max_num_diff_blocks and max_num_total_blocks
+ * of Statistics_Error_Rates: the point can be stopped as soon as the
+ * confidence interval of the FER is narrower than max_relative_width times
+ * the FER, or when its time budget is spent.
+ *
+ * Reset() starts a simulation point, Check() is called with the current counts
+ * after each frame and Run() writes the achieved interval to the status ports.
+ * The interval is recomputed only if the number of errors changed or the
+ * number of frames grew by 1%.
+ *
+ * With importance sampling the counts of erroneous frames are biased, the
+ * chain calls Check_Weighted() with the weighted FER estimate and its variance
+ * instead, see Statistics_Weighted_Error_Rates. The interval is then the
+ * normal interval FER +- z * sqrt(variance) for the confidence level.
+ *
+ * \ingroup modules
+ */
+class Statistics_Confidence : public Statistics_Confidence_Interface,
+                              public Statistics_Confidence_Parameter
+{
+
+public:
+
+	/// Reasons for the end of a simulation point
+	enum STOP_REASON_ENUM
+	{
+		STOP_LIMITS,      /*!< Limits of the error rate statistics */
+		STOP_PRECISION,   /*!< Target relative width reached */
+		STOP_TIME_BUDGET  /*!< Time budget spent */
+	};
+
+	Statistics_Confidence();
+
+	virtual ~Statistics_Confidence() { }
+
+	/// Write the achieved confidence interval of the current simulation point to the status ports.
+	int Run();
+
+	/// Start a new simulation point.
+	void Reset();
+
+	/// Update the counts, returns true if the simulation point can be stopped.
+	/**
+	 * \param frames        Number of frames of the simulation point.
+	 * \param frame_errors  Number of erroneous frames of the simulation point.
+	 */
+	bool Check(ull_int frames, ull_int frame_errors);
+
+	/// Update the importance sampling estimate, returns true if the simulation point can be stopped.
+	/**
+	 * \param frames        Number of frames of the simulation point.
+	 * \param frame_errors  Number of erroneous frames of the simulation point (unweighted).
+	 * \param fer           Weighted FER estimate.
+	 * \param fer_variance  Variance of the weighted FER estimate.
+	 */
+	bool Check_Weighted(ull_int frames, ull_int frame_errors, double fer, double fer_variance);
+
+	/// Has the simulation point reached the target precision or the time budget?
+	bool Stopped() const { return stop_; }
+
+	/// Estimated number of frames until the target precision is reached.
+	/**
+	 * Extrapolates the width of the interval of the last Check() with the
+	 * square root of the number of frames. Returns -1 if stopping is disabled
+	 * or there is no error yet, 0 if the point can be stopped.
+	 */
+	double Remaining_Frames();
+
+	/// Seconds until the time budget is spent, -1 without time budget.
+	double Remaining_Time();
+
+private:
+
+	/// Stopping decision on the current counts, see Check().
+	bool Check_Stop();
+
+	/// Confidence interval of the current counts according to the interval parameter.
+	void Calc_Interval(double& lower, double& upper);
+
+	/// Current FER estimate
+	double Error_Rate() const;
+
+	/// Read the monotonic clock in seconds.
+	static double Read_Time();
+
+	double start_time_;
+
+	ull_int frames_;
+	ull_int frame_errors_;
+
+	/// Weighted FER estimate and its variance, only if weighted_
+	bool weighted_;
+	double fer_;
+	double fer_variance_;
+
+	/// Counts of the last evaluation of the interval
+	ull_int eval_frames_;
+	ull_int eval_frame_errors_;
+
+	bool stop_;
+	STOP_REASON_ENUM stop_reason_;
+};
+}
+#endif // STAT_CONFIDENCE_H_
@@ -0,0 +1,66 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Interface of the confidence-based stopping criterion
+/// \date   2026/10/19
+//
+
+#ifndef STAT_CONFIDENCE_IFACE_H_
+#define STAT_CONFIDENCE_IFACE_H_
+
+#include "../modules/base/base_iface.h"
+
+
+namespace cse_lib {
+
+/// Interface of the confidence-based stopping criterion
+/**
+ * \ingroup interface
+ */
+class Statistics_Confidence_Interface : public Base_Interface
+{
+
+public:
+
+	Statistics_Confidence_Interface()
+	{
+		num_total_blocks.Register("num_total_blocks", status_out_list_);
+		num_diff_blocks.Register("num_diff_blocks", status_out_list_);
+		error_rate_blocks.Register("error_rate_blocks", status_out_list_);
+		error_rate_blocks_lower.Register("error_rate_blocks_lower", status_out_list_);
+		error_rate_blocks_upper.Register("error_rate_blocks_upper", status_out_list_);
+		relative_width.Register("relative_width", status_out_list_);
+		stop_reason.Register("stop_reason", status_out_list_);
+	}
+
+	virtual ~Statistics_Confidence_Interface() { }
+
+	/// Number of frames of the simulation point
+	Status_Out<ull_int> num_total_blocks;
+
+	/// Number of erroneous frames of the simulation point
+	Status_Out<ull_int> num_diff_blocks;
+
+	/// Frame error rate, the weighted estimate with importance sampling
+	Status_Out<double> error_rate_blocks;
+
+	/// Lower bound of the confidence interval of the frame error rate
+	Status_Out<double> error_rate_blocks_lower;
+
+	/// Upper bound of the confidence interval of the frame error rate
+	Status_Out<double> error_rate_blocks_upper;
+
+	/// Achieved width of the confidence interval relative to the frame error rate, -1 without errors
+	Status_Out<double> relative_width;
+
+	/// Reason for the end of the simulation point
+	/**
+	 * 0: limits of the error rate statistics, 1: target relative width reached,
+	 * 2: time budget spent
+	 */
+	Status_Out<unsigned int> stop_reason;
+};
+}
+#endif // STAT_CONFIDENCE_IFACE_H_
@@ -0,0 +1,101 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Parameters of the confidence-based stopping criterion
+/// \date   2026/10/19
+//
+
+#ifndef STAT_CONFIDENCE_PARAM_H_
+#define STAT_CONFIDENCE_PARAM_H_
+
+#include "cse_lib.h"
+
+
+namespace cse_lib {
+
+/// Parameter class of the confidence-based stopping criterion
+/**
+ * \ingroup parameter
+ */
+class Statistics_Confidence_Parameter : public Base_Parameter
+{
+
+public:
+
+	Statistics_Confidence_Parameter()
+	{
+		instance_name(Unique_ID());
+		Set_Default_Values();
+	}
+
+	virtual ~Statistics_Confidence_Parameter(){}
+
+	/// Unique identification string of the module.
+	static std::string Unique_ID(){ return "Statistics_Confidence";}
+
+
+	/**************
+	 * Parameters *
+	 **************/
+
+	/// Confidence intervals of the FER
+	enum INTERVAL_ENUM
+	{
+		WILSON,         /*!< Wilson score interval */
+		CLOPPER_PEARSON /*!< Exact binomial interval, conservative */
+	};
+
+	/// Stop a simulation point when the FER is precise enough or the time budget is spent.
+	Param<bool> enabled;
+
+	/// Confidence interval of the FER, with importance sampling the normal interval is used
+	Param<INTERVAL_ENUM> interval;
+
+	/// Confidence level of the interval
+	Param<float> confidence;
+
+	/// Target width of the interval relative to the FER, (upper - lower) / FER
+	Param<float> max_relative_width;
+
+	/// Minimum number of frame errors before the interval is checked
+	Param<ull_int> min_num_diff_blocks;
+
+	/// Maximum wall-clock time of a simulation point in seconds, 0: unlimited
+	Param<float> time_budget;
+
+
+protected:
+
+
+	/******************
+	 * Default values *
+	 ******************/
+
+	/// Set all parameters to their default values.
+	/**
+	 * Default values:
+	 *  - enabled             : false
+	 *  - interval            : WILSON
+	 *  - confidence          : 0.95
+	 *  - max_relative_width  : 0.2
+	 *  - min_num_diff_blocks : 10
+	 *  - time_budget         : 0.0
+	 */
+	void Set_Default_Values()
+	{
+		interval.Link_Value_String(WILSON,          "WILSON");
+		interval.Link_Value_String(CLOPPER_PEARSON, "CLOPPER_PEARSON");
+
+		enabled.Init(false, "enabled", param_list_);
+		interval.Init(WILSON, "interval", param_list_);
+		confidence.Init(0.95, "confidence", param_list_);
+		max_relative_width.Init(0.2, "max_relative_width", param_list_);
+		min_num_diff_blocks.Init(10, "min_num_diff_blocks", param_list_);
+		time_budget.Init(0.0, "time_budget", param_list_);
+	}
+
+};
+}
+#endif // STAT_CONFIDENCE_PARAM_H_
@@ -0,0 +1,185 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Error rates statistics on packed bits and with an all-zero reference shortcut
+/// \date   2026/10/19
+//
+
+#include "stat_error_rates_fast.h"
+
+using namespace hlp_fct::logging;
+using namespace std;
+
+namespace cse_lib {
+
+Statistics_Error_Rates_Fast::Statistics_Error_Rates_Fast()
+	: num_total_blocks_(0), num_total_bits_(0), num_zero_ref_bits_(0)
+{
+	input_bits_packed.Register("input_bits_packed", input_data_list_);
+	input_bits_ref_packed.Register("input_bits_ref_packed", input_data_list_);
+}
+
+
+void Statistics_Error_Rates_Fast::Zero_Reference(unsigned int num_bits)
+{
+	num_zero_ref_bits_ = num_bits;
+}
+
+
+void Statistics_Error_Rates_Fast::Init()
+{
+	unsigned int num_rows = input_bits().dim1();
+
+	num_total_blocks_ = 0;
+	num_total_bits_   = 0;
+
+	try
+	{
+		num_diff_blocks_.Resize(num_rows);
+		num_diff_bits_.Resize(num_rows);
+	}
+	catch(bad_alloc&)
+	{
+		Msg(ERROR, instance_name(), "Memory allocation failure!");
+		throw;
+	}
+	num_diff_blocks_.Clear();
+	num_diff_bits_.Clear();
+
+	num_diff_bits.Reset();
+	error_rate_bits.Reset();
+	num_diff_blocks.Reset();
+	error_rate_blocks.Reset();
+
+	num_diff_bits.dim_name(0, out_port_inner_dim_name());
+	error_rate_bits.dim_name(0, out_port_inner_dim_name());
+	num_diff_blocks.dim_name(0, out_port_inner_dim_name());
+	error_rate_blocks.dim_name(0, out_port_inner_dim_name());
+
+	init_time_ = clock();
+
+	param_list_.config_modified(false);
+	input_data_list_.port_modified(false);
+}
+
+
+unsigned int Statistics_Error_Rates_Fast::Count_Row(unsigned int row, unsigned int num_bits,
+                                                    bool packed, const Buffer<packed_bit> *ref_packed)
+{
+	unsigned int num_errors = 0;
+
+	if (packed)
+	{
+		const ull_int *words = &input_bits_packed()[row][0];
+
+		if (num_zero_ref_bits_ > 0)
+			return bit_packing::Count_Ones(words, num_bits);
+
+		return bit_packing::Count_Diff_Bits(words, ref_packed->Data_Ptr(), num_bits);
+	}
+
+	const u_int *bits = &input_bits()[row][0];
+
+	// Against the all-zero code word every one is an error.
+	if (num_zero_ref_bits_ > 0)
+	{
+		for (unsigned int i = 0; i < num_bits; i++)
+			num_errors += (bits[i] != 0);
+	}
+	else if (ref_packed != NULL)
+	{
+		for (unsigned int i = 0; i < num_bits; i++)
+			num_errors += (bits[i] != (*ref_packed)[i]);
+	}
+	else
+	{
+		const u_int *ref = &input_bits_ref()[0];
+
+		for (unsigned int i = 0; i < num_bits; i++)
+			num_errors += (bits[i] != ref[i]);
+	}
+
+	return num_errors;
+}
+
+
+int Statistics_Error_Rates_Fast::Run()
+{
+	Buffer<u_int, 2> &bits = input_bits();
+
+	if (param_list_.config_modified() || input_data_list_.port_modified() ||
+	    num_diff_blocks_.length() != bits.dim1())
+		Init();
+
+	if (bits.dim1() == 0)
+		return 0;
+
+	unsigned int num_rows = bits.dim1();
+	unsigned int num_bits;
+	const Buffer<packed_bit> *ref_packed = NULL;
+
+	if (num_zero_ref_bits_ > 0)
+		num_bits = min(bits.dim2(), num_zero_ref_bits_);
+	else if (input_bits_ref_packed().length() > 0)
+	{
+		ref_packed = &input_bits_ref_packed();
+		num_bits = min(bits.dim2(), ref_packed->length());
+	}
+	else
+		num_bits = min(bits.dim2(), input_bits_ref().length());
+
+	bool packed = (input_bits_packed().dim1() == num_rows &&
+	               input_bits_packed().dim2() >= bit_packing::Num_Words(num_bits));
+
+	// Pack the reference once for all rows.
+	if (packed && num_zero_ref_bits_ == 0 && ref_packed == NULL)
+	{
+		ref_packed_.Pack(input_bits_ref());
+		ref_packed = &ref_packed_;
+	}
+
+	for (unsigned int r = 0; r < num_rows; r++)
+	{
+		unsigned int num_errors = (num_bits > 0) ? Count_Row(r, num_bits, packed, ref_packed) : 0;
+
+		num_diff_bits_[r] += num_errors;
+		if (num_errors > 0)
+			num_diff_blocks_[r]++;
+	}
+
+	num_total_blocks_++;
+	num_total_bits_ += num_bits;
+
+	unsigned int offset = out_port_inner_dim_addr_offset();
+
+	num_total_blocks().Write(num_total_blocks_);
+	num_total_bits().Write(num_total_bits_);
+
+	for (unsigned int r = 0; r < num_rows; r++)
+	{
+		float fer = static_cast<float>(num_diff_blocks_[r]) / num_total_blocks_;
+		float ber = (num_total_bits_ > 0) ? static_cast<float>(num_diff_bits_[r]) / num_total_bits_ : 0.0f;
+
+		num_diff_bits(r + offset)().Write(num_diff_bits_[r]);
+		error_rate_bits(r + offset)().Write(ber);
+		num_diff_blocks(r + offset)().Write(num_diff_blocks_[r]);
+		error_rate_blocks(r + offset)().Write(fer);
+	}
+
+	ull_int num_diff_blocks_last = num_diff_blocks_[num_rows - 1];
+
+	if (print_status_permanent())
+		Dump_Intermediate_Result(instance_name(), max_num_diff_blocks(), max_num_total_blocks(),
+		                         num_diff_blocks_last, num_total_blocks_,
+		                         static_cast<float>(num_diff_blocks_last) / num_total_blocks_,
+		                         (num_total_bits_ > 0) ? static_cast<float>(num_diff_bits_[num_rows - 1]) / num_total_bits_ : 0.0f,
+		                         Calc_Throughput(num_total_bits_));
+
+	if (num_total_blocks_ >= max_num_total_blocks() || num_diff_blocks_last >= max_num_diff_blocks())
+		return 1;
+
+	return 0;
+}
+}
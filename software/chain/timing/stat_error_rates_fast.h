@@ -0,0 +1,84 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Error rates statistics on packed bits and with an all-zero reference shortcut
+/// \date   2026/10/19
+//
+
+#ifndef STAT_ERROR_RATES_FAST_H_
+#define STAT_ERROR_RATES_FAST_H_
+
+#include "cse_lib.h"
+
+
+namespace cse_lib {
+
+/// Statistics_Error_Rates<2> on packed bits and for all-zero code word simulations
+/**
+ * Drop-in replacement of Statistics_Error_Rates<2>: same parameters, same
+ * status ports and the same stopping rule, i.e., Run() returns 1 if
+ * max_num_total_blocks frames are processed or the last row of input_bits
+ * (e.g. the last iteration) has max_num_diff_blocks erroneous frames.
+ *
+ * If input_bits_packed is connected, e.g. to output_bits_packed of the
+ * decoder, the rows are compared word by word with XOR and popcount (see
+ * bit_packing) instead of bit by bit. The reference is taken from
+ * input_bits_ref_packed if connected, otherwise input_bits_ref is packed once
+ * per block for all rows. input_bits still has to be connected, only its
+ * dimensions are read. The counts are identical to the ones of the unpacked
+ * comparison.
+ *
+ * Zero_Reference(num_bits) replaces input_bits_ref by num_bits zeros. The
+ * reference is not read anymore and the number of bit errors of a row is the
+ * number of ones among its first num_bits hard decisions. Zero_Reference(0)
+ * switches back to input_bits_ref.
+ *
+ * \ingroup modules
+ */
+class Statistics_Error_Rates_Fast : public Statistics_Error_Rates<2>
+{
+
+public:
+
+	Statistics_Error_Rates_Fast();
+
+	virtual ~Statistics_Error_Rates_Fast() { }
+
+	/// Process one block
+	int Run();
+
+	/// Rows of input_bits packed into 64 bit words (optional)
+	Data_In<ull_int, 2> input_bits_packed;
+
+	/// Packed reference bits, replaces input_bits_ref if connected (optional)
+	Data_In<packed_bit> input_bits_ref_packed;
+
+	/// Compare against num_bits zeros instead of input_bits_ref (0: use input_bits_ref).
+	void Zero_Reference(unsigned int num_bits);
+
+	/// Number of bits of the all-zero reference, 0 if input_bits_ref is used.
+	unsigned int Zero_Reference() const { return num_zero_ref_bits_; }
+
+private:
+
+	void Init();
+
+	/// Number of bit errors of a row.
+	unsigned int Count_Row(unsigned int row, unsigned int num_bits,
+	                       bool packed, const Buffer<packed_bit> *ref_packed);
+
+	/// input_bits_ref packed, if input_bits_ref_packed is not connected
+	Buffer<packed_bit> ref_packed_;
+
+	Buffer<ull_int> num_diff_blocks_;
+	Buffer<ull_int> num_diff_bits_;
+
+	ull_int num_total_blocks_;
+	ull_int num_total_bits_;
+
+	unsigned int num_zero_ref_bits_;
+};
+}
+#endif // STAT_ERROR_RATES_FAST_H_
@@ -0,0 +1,87 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Throughput statistics of a simulation point
+/// \date   2026/10/19
+//
+
+#include <ctime>
+#include <iostream>
+#include <iomanip>
+
+#include "stat_throughput.h"
+
+using namespace std;
+
+namespace cse_lib {
+
+Statistics_Throughput::Statistics_Throughput()
+{
+	Reset();
+}
+
+
+double Statistics_Throughput::Read_Clock(clockid_t clock_id)
+{
+	timespec ts;
+	if (clock_gettime(clock_id, &ts) != 0)
+		return 0.0;
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+void Statistics_Throughput::Reset()
+{
+	frames_     = 0;
+	info_bits_  = 0;
+	iterations_ = 0;
+
+	decoder_wall_       = 0.0;
+	decoder_thread_cpu_ = 0.0;
+	frame_wall_         = 0.0;
+	frame_thread_cpu_   = 0.0;
+
+	start_wall_ = Read_Clock(CLOCK_MONOTONIC);
+	start_cpu_  = Read_Clock(CLOCK_PROCESS_CPUTIME_ID);
+}
+
+
+int Statistics_Throughput::Run()
+{
+	double point_wall = Read_Clock(CLOCK_MONOTONIC)          - start_wall_;
+	double cpu        = Read_Clock(CLOCK_PROCESS_CPUTIME_ID) - start_cpu_;
+	double wall       = decoder_wall_;
+	double thread_cpu = decoder_thread_cpu_;
+
+	wall_time().Write(wall);
+	point_wall_time().Write(point_wall);
+	cpu_time().Write(cpu);
+	thread_cpu_time().Write(thread_cpu);
+	num_frames().Write(frames_);
+	num_info_bits().Write(info_bits_);
+	num_iterations().Write(iterations_);
+
+	frames_per_second().Write(wall > 0 ? frames_ / wall : 0.0);
+	info_bits_per_second().Write(wall > 0 ? info_bits_ / wall : 0.0);
+	iterations_per_second().Write(wall > 0 ? iterations_ / wall : 0.0);
+	info_bits_per_thread_cpu_second().Write(thread_cpu > 0 ? info_bits_ / thread_cpu : 0.0);
+	mean_iterations().Write(frames_ ? static_cast<double>(iterations_) / frames_ : 0.0);
+
+	if (print_status())
+	{
+		cout << instance_name() << ": "
+		     << fixed << setprecision(1)
+		     << (wall > 0 ? frames_ / wall : 0.0) << " frames/s - "
+		     << (wall > 0 ? info_bits_ / wall / 1000.0 : 0.0) << " kbit/s - "
+		     << (wall > 0 ? iterations_ / wall : 0.0) << " iterations/s - "
+		     << setprecision(2)
+		     << (frames_ ? static_cast<double>(iterations_) / frames_ : 0.0) << " iterations/frame - "
+		     << "decoder " << wall << " s / point " << point_wall << " s / CPU " << cpu << " s" << endl;
+		cout.unsetf(ios::fixed);
+	}
+
+	return 0;
+}
+}
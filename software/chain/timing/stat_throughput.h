@@ -0,0 +1,106 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Throughput statistics of a simulation point
+/// \date   2026/10/19
+//
+
+#ifndef STAT_THROUGHPUT_H_
+#define STAT_THROUGHPUT_H_
+
+#include <ctime>
+
+#include "stat_throughput_iface.h"
+#include "stat_throughput_param.h"
+
+
+namespace cse_lib {
+
+/// Wall-clock and CPU-time throughput of a simulation point
+/**
+ * Reset() starts the measurement of a simulation point and Run() writes the
+ * rates of the point to the status ports. The decoder call of each frame is
+ * enclosed by Start_Frame() and Count_Frame(), only this time is accumulated
+ * and the rates refer to it. So each decoder variant of a chain measures its
+ * own decoder and not the whole frame loop with the other variants, the
+ * source, the encoder and the channel. The time is taken from the monotonic
+ * clock and the CPU time of the calling thread, so the numbers stay
+ * meaningful if the chain runs in several threads. The process CPU time and
+ * the wall-clock time of the whole simulation point are reported as well.
+ *
+ * \ingroup modules
+ */
+class Statistics_Throughput : public Statistics_Throughput_Interface,
+                              public Statistics_Throughput_Parameter
+{
+
+public:
+
+	Statistics_Throughput();
+
+	virtual ~Statistics_Throughput() { }
+
+	/// Write the statistics of the current simulation point to the status ports.
+	int Run();
+
+	/// Start the measurement of a new simulation point.
+	void Reset();
+
+	/// Start the time measurement of a decoder call, see Count_Frame().
+	void Start_Frame()
+	{
+		frame_wall_       = Read_Clock(CLOCK_MONOTONIC);
+		frame_thread_cpu_ = Read_Clock(CLOCK_THREAD_CPUTIME_ID);
+	}
+
+	/// Account a processed frame, the time since Start_Frame() is its decoding time.
+	/**
+	 * \param info_bits   Number of information bits of the frame.
+	 * \param iterations  Number of decoder iterations spent on the frame.
+	 */
+	void Count_Frame(unsigned int info_bits, unsigned int iterations)
+	{
+		decoder_wall_       += Read_Clock(CLOCK_MONOTONIC)         - frame_wall_;
+		decoder_thread_cpu_ += Read_Clock(CLOCK_THREAD_CPUTIME_ID) - frame_thread_cpu_;
+
+		frames_++;
+		info_bits_  += info_bits;
+		iterations_ += iterations;
+	}
+
+	/// Number of frames since Reset().
+	ull_int frames() const { return frames_; }
+
+	/// Number of information bits since Reset().
+	ull_int info_bits() const { return info_bits_; }
+
+	/// Wall-clock time since Reset() in seconds.
+	double Elapsed_Wall_Time() const { return Read_Clock(CLOCK_MONOTONIC) - start_wall_; }
+
+	/// Wall-clock time of the decoder calls since Reset() in seconds.
+	double Decoder_Wall_Time() const { return decoder_wall_; }
+
+private:
+
+	/// Read a clock in seconds.
+	static double Read_Clock(clockid_t clock_id);
+
+	double start_wall_;
+	double start_cpu_;
+
+	// Start of the current decoder call
+	double frame_wall_;
+	double frame_thread_cpu_;
+
+	// Accumulated time of the decoder calls
+	double decoder_wall_;
+	double decoder_thread_cpu_;
+
+	ull_int frames_;
+	ull_int info_bits_;
+	ull_int iterations_;
+};
+}
+#endif // STAT_THROUGHPUT_H_
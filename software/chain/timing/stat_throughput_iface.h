@@ -0,0 +1,85 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Interface of the throughput statistics
+/// \date   2026/10/19
+//
+
+#ifndef STAT_THROUGHPUT_IFACE_H_
+#define STAT_THROUGHPUT_IFACE_H_
+
+#include "../modules/base/base_iface.h"
+
+
+namespace cse_lib {
+
+/// Interface of the throughput statistics
+/**
+ * All rates refer to the wall-clock time of the decoder calls unless stated
+ * otherwise.
+ *
+ * \ingroup interface
+ */
+class Statistics_Throughput_Interface : public Base_Interface
+{
+
+public:
+
+	Statistics_Throughput_Interface()
+	{
+		wall_time.Register("wall_time", status_out_list_);
+		point_wall_time.Register("point_wall_time", status_out_list_);
+		cpu_time.Register("cpu_time", status_out_list_);
+		thread_cpu_time.Register("thread_cpu_time", status_out_list_);
+		num_frames.Register("num_frames", status_out_list_);
+		num_info_bits.Register("num_info_bits", status_out_list_);
+		num_iterations.Register("num_iterations", status_out_list_);
+		frames_per_second.Register("frames_per_second", status_out_list_);
+		info_bits_per_second.Register("info_bits_per_second", status_out_list_);
+		iterations_per_second.Register("iterations_per_second", status_out_list_);
+		info_bits_per_thread_cpu_second.Register("info_bits_per_thread_cpu_second", status_out_list_);
+		mean_iterations.Register("mean_iterations", status_out_list_);
+	}
+
+	virtual ~Statistics_Throughput_Interface() { }
+
+	/// Wall-clock time of the decoder calls in seconds
+	Status_Out<double> wall_time;
+
+	/// Elapsed wall-clock time of the simulation point (all modules) in seconds
+	Status_Out<double> point_wall_time;
+
+	/// CPU time of the process (all threads, all modules) during the simulation point in seconds
+	Status_Out<double> cpu_time;
+
+	/// CPU time of the measuring thread spent in the decoder calls in seconds
+	Status_Out<double> thread_cpu_time;
+
+	/// Number of processed frames
+	Status_Out<ull_int> num_frames;
+
+	/// Number of processed information bits
+	Status_Out<ull_int> num_info_bits;
+
+	/// Number of performed decoder iterations
+	Status_Out<ull_int> num_iterations;
+
+	/// Frames per second
+	Status_Out<double> frames_per_second;
+
+	/// Information bits per second
+	Status_Out<double> info_bits_per_second;
+
+	/// Decoder iterations per second
+	Status_Out<double> iterations_per_second;
+
+	/// Information bits per second of CPU time of the measuring thread
+	Status_Out<double> info_bits_per_thread_cpu_second;
+
+	/// Average number of decoder iterations per frame
+	Status_Out<double> mean_iterations;
+};
+}
+#endif // STAT_THROUGHPUT_IFACE_H_
@@ -0,0 +1,66 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Parameters of the throughput statistics
+/// \date   2026/10/19
+//
+
+#ifndef STAT_THROUGHPUT_PARAM_H_
+#define STAT_THROUGHPUT_PARAM_H_
+
+#include "cse_lib.h"
+
+
+namespace cse_lib {
+
+/// Parameter class of the throughput statistics
+/**
+ * \ingroup parameter
+ */
+class Statistics_Throughput_Parameter : public Base_Parameter
+{
+
+public:
+
+	Statistics_Throughput_Parameter()
+	{
+		instance_name(Unique_ID());
+		Set_Default_Values();
+	}
+
+	virtual ~Statistics_Throughput_Parameter(){}
+
+	/// Unique identification string of the module.
+	static std::string Unique_ID(){ return "Statistics_Throughput";}
+
+
+	/**************
+	 * Parameters *
+	 **************/
+
+	/// Print the throughput of a simulation point on the console.
+	Param<bool> print_status;
+
+
+protected:
+
+
+	/******************
+	 * Default values *
+	 ******************/
+
+	/// Set all parameters to their default values.
+	/**
+	 * Default values:
+	 *  - print_status : true
+	 */
+	void Set_Default_Values()
+	{
+		print_status.Init(true, "print_status", param_list_);
+	}
+
+};
+}
+#endif // STAT_THROUGHPUT_PARAM_H_
@@ -0,0 +1,90 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Weighted error rates statistics for importance sampling
+/// \date   2026/10/19
+//
+
+#include <cmath>
+
+#include "stat_weighted_error_rates.h"
+
+using namespace std;
+
+namespace cse_lib {
+
+Statistics_Weighted_Error_Rates::Statistics_Weighted_Error_Rates()
+{
+	Reset();
+}
+
+
+void Statistics_Weighted_Error_Rates::Reset()
+{
+	frames_        = 0;
+	diff_frames_   = 0;
+	sum_blocks_    = 0.0;
+	sum_sq_blocks_ = 0.0;
+	sum_bits_      = 0.0;
+	sum_sq_bits_   = 0.0;
+}
+
+
+int Statistics_Weighted_Error_Rates::Run()
+{
+	Buffer<u_int, 2> &bits = input_bits();
+	Buffer<u_int> &ref = input_bits_ref();
+	unsigned int bit_errors = 0;
+
+	if (bits.dim1() == 0 || ref.length() == 0)
+		return 0;
+
+	unsigned int last_row = bits.dim1() - 1;
+	unsigned int num_bits = min(bits.dim2(), ref.length());
+
+	for (unsigned int i = 0; i < num_bits; i++)
+		if (bits[last_row][i] != ref[i])
+			bit_errors++;
+
+	double weight = exp(input_log_weight()[0]);
+
+	frames_++;
+	if (bit_errors > 0)
+	{
+		double weighted_bits = weight * bit_errors / num_bits;
+
+		diff_frames_++;
+		sum_blocks_    += weight;
+		sum_sq_blocks_ += weight * weight;
+		sum_bits_      += weighted_bits;
+		sum_sq_bits_   += weighted_bits * weighted_bits;
+	}
+
+	// Mean and variance of the mean of the weighted errors.
+	double fer = sum_blocks_ / frames_;
+	double ber = sum_bits_ / frames_;
+	double fer_variance = max(0.0, sum_sq_blocks_ / frames_ - fer * fer) / frames_;
+	double ber_variance = max(0.0, sum_sq_bits_ / frames_ - ber * ber) / frames_;
+	double relative_error = (fer > 0) ? sqrt(fer_variance) / fer : -1.0;
+
+	num_total_blocks().Write(frames_);
+	num_diff_blocks().Write(diff_frames_);
+	error_rate_blocks().Write(fer);
+	error_rate_blocks_variance().Write(fer_variance);
+	error_rate_blocks_relative_error().Write(relative_error);
+	error_rate_bits().Write(ber);
+	error_rate_bits_variance().Write(ber_variance);
+
+	if (frames_ >= max_num_total_blocks())
+		return 1;
+
+	if (max_relative_error() > 0 &&
+	    diff_frames_ >= min_num_diff_blocks() &&
+	    relative_error >= 0 && relative_error <= max_relative_error())
+		return 1;
+
+	return 0;
+}
+}
@@ -0,0 +1,63 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Weighted error rates statistics for importance sampling
+/// \date   2026/10/19
+//
+
+#ifndef STAT_WEIGHTED_ERROR_RATES_H_
+#define STAT_WEIGHTED_ERROR_RATES_H_
+
+#include "stat_weighted_error_rates_iface.h"
+#include "stat_weighted_error_rates_param.h"
+
+
+namespace cse_lib {
+
+/// Error rates of importance sampling simulations
+/**
+ * Each frame is weighted with the likelihood ratio exp(input_log_weight) of
+ * the biased channel, e.g. Channel_AWGN_IS. The FER estimate is the mean of
+ * w * e over all frames, where e is 1 for an erroneous frame, the BER estimate
+ * is the mean of w times the fraction of erroneous bits. The variance of the
+ * estimates is calculated from the second moments of the weighted errors.
+ *
+ * Reset() starts a simulation point, Run() is called after each frame and
+ * returns 1 if max_num_total_blocks frames are processed or the relative
+ * standard error of the FER is below max_relative_error.
+ *
+ * \ingroup modules
+ */
+class Statistics_Weighted_Error_Rates : public Statistics_Weighted_Error_Rates_Interface,
+                                        public Statistics_Weighted_Error_Rates_Parameter
+{
+
+public:
+
+	Statistics_Weighted_Error_Rates();
+
+	virtual ~Statistics_Weighted_Error_Rates() { }
+
+	/// Process one frame, returns 1 if the simulation point can be stopped.
+	int Run();
+
+	/// Start a new simulation point.
+	void Reset();
+
+private:
+
+	ull_int frames_;
+	ull_int diff_frames_;
+
+	/// Sums of w * e and (w * e)^2 of the frame errors
+	double sum_blocks_;
+	double sum_sq_blocks_;
+
+	/// Sums of w * b and (w * b)^2 of the bit error fractions
+	double sum_bits_;
+	double sum_sq_bits_;
+};
+}
+#endif // STAT_WEIGHTED_ERROR_RATES_H_
@@ -0,0 +1,75 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Interface of the weighted error rates statistics
+/// \date   2026/10/19
+//
+
+#ifndef STAT_WEIGHTED_ERROR_RATES_IFACE_H_
+#define STAT_WEIGHTED_ERROR_RATES_IFACE_H_
+
+#include "../modules/base/base_iface.h"
+
+
+namespace cse_lib {
+
+/// Interface of the weighted error rates statistics
+/**
+ * \ingroup interface
+ */
+class Statistics_Weighted_Error_Rates_Interface : public Base_Interface
+{
+
+public:
+
+	Statistics_Weighted_Error_Rates_Interface()
+	{
+		input_bits.Register("input_bits", input_data_list_);
+		input_bits_ref.Register("input_bits_ref", input_data_list_);
+		input_log_weight.Register("input_log_weight", input_data_list_);
+
+		num_total_blocks.Register("num_total_blocks", status_out_list_);
+		num_diff_blocks.Register("num_diff_blocks", status_out_list_);
+		error_rate_blocks.Register("error_rate_blocks", status_out_list_);
+		error_rate_blocks_variance.Register("error_rate_blocks_variance", status_out_list_);
+		error_rate_blocks_relative_error.Register("error_rate_blocks_relative_error", status_out_list_);
+		error_rate_bits.Register("error_rate_bits", status_out_list_);
+		error_rate_bits_variance.Register("error_rate_bits_variance", status_out_list_);
+	}
+
+	virtual ~Statistics_Weighted_Error_Rates_Interface() { }
+
+	/// Decoded bits, the last row (e.g. the last iteration) is evaluated
+	Data_In<u_int, 2> input_bits;
+
+	/// Reference bits
+	Data_In<u_int> input_bits_ref;
+
+	/// Natural logarithm of the likelihood ratio weight of the frame
+	Data_In<double> input_log_weight;
+
+	/// Number of frames
+	Status_Out<ull_int> num_total_blocks;
+
+	/// Number of erroneous frames (not weighted)
+	Status_Out<ull_int> num_diff_blocks;
+
+	/// Weighted frame error rate
+	Status_Out<double> error_rate_blocks;
+
+	/// Variance of the weighted frame error rate estimate
+	Status_Out<double> error_rate_blocks_variance;
+
+	/// Standard error of the weighted frame error rate divided by the estimate
+	Status_Out<double> error_rate_blocks_relative_error;
+
+	/// Weighted bit error rate
+	Status_Out<double> error_rate_bits;
+
+	/// Variance of the weighted bit error rate estimate
+	Status_Out<double> error_rate_bits_variance;
+};
+}
+#endif // STAT_WEIGHTED_ERROR_RATES_IFACE_H_
@@ -0,0 +1,85 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Parameters of the weighted error rates statistics
+/// \date   2026/10/19
+//
+
+#ifndef STAT_WEIGHTED_ERROR_RATES_PARAM_H_
+#define STAT_WEIGHTED_ERROR_RATES_PARAM_H_
+
+#include "cse_lib.h"
+
+
+namespace cse_lib {
+
+/// Parameter class of the weighted error rates statistics
+/**
+ * \ingroup parameter
+ */
+class Statistics_Weighted_Error_Rates_Parameter : public Base_Parameter
+{
+
+public:
+
+	Statistics_Weighted_Error_Rates_Parameter()
+	{
+		instance_name(Unique_ID());
+		Set_Default_Values();
+	}
+
+	virtual ~Statistics_Weighted_Error_Rates_Parameter(){}
+
+	/// Unique identification string of the module.
+	static std::string Unique_ID(){ return "Statistics_Weighted_Error_Rates";}
+
+
+	/**************
+	 * Parameters *
+	 **************/
+
+	/// Number of frames to process
+	/**
+	 * If this number is reached the module's Run function returns a value to
+	 * indicate that the maximum number is reached.
+	 */
+	Param<ull_int> max_num_total_blocks;
+
+	/// Target relative standard error of the weighted FER, 0: not used
+	/**
+	 * If the standard error of the estimate divided by the estimate falls below
+	 * this value after min_num_diff_blocks erroneous frames, the module's Run
+	 * function returns a value to indicate that the point can be stopped.
+	 */
+	Param<float> max_relative_error;
+
+	/// Minimum number of erroneous frames before max_relative_error is checked
+	Param<ull_int> min_num_diff_blocks;
+
+
+protected:
+
+
+	/******************
+	 * Default values *
+	 ******************/
+
+	/// Set all parameters to their default values.
+	/**
+	 * Default values:
+	 *  - max_num_total_blocks : 100000
+	 *  - max_relative_error   : 0.1
+	 *  - min_num_diff_blocks  : 100
+	 */
+	void Set_Default_Values()
+	{
+		max_num_total_blocks.Init(100000, "max_num_total_blocks", param_list_);
+		max_relative_error.Init(0.1, "max_relative_error", param_list_);
+		min_num_diff_blocks.Init(100, "min_num_diff_blocks", param_list_);
+	}
+
+};
+}
+#endif // STAT_WEIGHTED_ERROR_RATES_PARAM_H_
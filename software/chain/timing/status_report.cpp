@@ -0,0 +1,269 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Machine-readable progress report of a simulation
+/// \date   2026/10/19
+//
+
+#include <ctime>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <unistd.h>
+
+#include "status_report.h"
+#include "confidence_interval.h"
+
+using namespace hlp_fct::logging;
+using namespace std;
+
+namespace cse_lib {
+
+Status_Report::Status_Report()
+{
+	point_index_      = -1;
+	start_time_       = Read_Time();
+	point_start_time_ = start_time_;
+	next_update_      = start_time_;
+}
+
+
+double Status_Report::Read_Time()
+{
+	timespec ts;
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+		return 0.0;
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+
+void Status_Report::Begin_Point(Manage_Module_Config& xml_config)
+{
+	Manage_Module_Config::ITER_VAR_LIST_TYPE& iter_vars = xml_config.iter_var_list();
+
+	point_index_++;
+	point_start_time_ = Read_Time();
+	watch_list_.clear();
+
+	point_names_.clear();
+	point_values_.clear();
+	for (unsigned int i = 0; i < iter_vars.length(); i++)
+	{
+		point_names_.push_back(iter_vars.Get_Ref(i).name());
+		point_values_.push_back(iter_vars.Get_Ref(i).curr_val());
+	}
+}
+
+
+void Status_Report::Watch(Error_Rates_Type& error_rates, unsigned int iteration, Statistics_Throughput& throughput,
+                          Statistics_Confidence *confidence,
+                          Statistics_Weighted_Error_Rates *weighted_error_rates)
+{
+	Watch_Entry entry;
+
+	entry.error_rates          = &error_rates;
+	entry.iteration            = iteration;
+	entry.throughput           = &throughput;
+	entry.confidence           = confidence;
+	entry.weighted_error_rates = weighted_error_rates;
+	watch_list_.push_back(entry);
+}
+
+
+void Status_Report::End_Point()
+{
+	if (enabled())
+		Write_Status("point_done");
+}
+
+
+void Status_Report::Finish()
+{
+	if (enabled())
+		Write_Status("finished");
+}
+
+
+void Status_Report::Write_String(ostream& os, const string& str)
+{
+	os << '"';
+	for (unsigned int i = 0; i < str.length(); i++)
+	{
+		if (str[i] == '"' || str[i] == '\\')
+			os << '\\' << str[i];
+		else if (static_cast<unsigned char>(str[i]) < 0x20)
+			os << ' ';
+		else
+			os << str[i];
+	}
+	os << '"';
+}
+
+
+void Status_Report::Write_Status(const string& state)
+{
+	double now = Read_Time();
+	string tmp_name = file_name() + ".tmp";
+
+	next_update_ = now + interval();
+
+	ofstream os(tmp_name.c_str());
+	if (!os)
+	{
+		Msg(WARNING, instance_name(), "Cannot write status file " + tmp_name + "!");
+		return;
+	}
+
+	os << setprecision(9);
+	os << "{\n";
+	os << "  \"state\": ";
+	Write_String(os, state);
+	os << ",\n";
+	os << "  \"pid\": " << getpid() << ",\n";
+	os << "  \"unix_time\": " << time(NULL) << ",\n";
+	os << "  \"elapsed_s\": " << now - start_time_ << ",\n";
+	os << "  \"confidence\": " << confidence() << ",\n";
+
+	os << "  \"point\": {\n";
+	os << "    \"index\": " << point_index_ << ",\n";
+	os << "    \"elapsed_s\": " << now - point_start_time_ << ",\n";
+	os << "    \"values\": {";
+	for (unsigned int i = 0; i < point_names_.size(); i++)
+	{
+		os << (i ? ", " : "");
+		Write_String(os, point_names_[i]);
+		os << ": ";
+		Write_String(os, point_values_[i]);
+	}
+	os << "}\n";
+	os << "  },\n";
+
+	os << "  \"decoders\": [";
+	for (unsigned int i = 0; i < watch_list_.size(); i++)
+	{
+		Error_Rates_Type &error_rates = *watch_list_[i].error_rates;
+		Statistics_Throughput &throughput = *watch_list_[i].throughput;
+		Statistics_Confidence *confidence_stop = watch_list_[i].confidence;
+		Statistics_Weighted_Error_Rates *weighted = watch_list_[i].weighted_error_rates;
+		unsigned int iteration = watch_list_[i].iteration;
+
+		ull_int frames       = error_rates.num_total_blocks().Read();
+		ull_int frame_errors = error_rates.num_diff_blocks(iteration)().Read();
+		ull_int bits         = error_rates.num_total_bits().Read();
+		ull_int bit_errors   = error_rates.num_diff_bits(iteration)().Read();
+		ull_int max_frames   = error_rates.max_num_total_blocks();
+		ull_int max_errors   = error_rates.max_num_diff_blocks();
+		double  wall         = throughput.Elapsed_Wall_Time();
+		double  decoder_wall = throughput.Decoder_Wall_Time();
+
+		double fer = frames ? static_cast<double>(frame_errors) / frames : 0.0;
+		double ber = bits ? static_cast<double>(bit_errors) / bits : 0.0;
+		double fer_lower, fer_upper, ber_lower, ber_upper;
+		double remaining;
+
+		if (weighted == NULL)
+		{
+			Wilson_Interval(frame_errors, frames, confidence(), fer_lower, fer_upper);
+			Wilson_Interval(bit_errors, bits, confidence(), ber_lower, ber_upper);
+
+			/*
+			 * Frames until the stopping criterion: the maximum number of frames or
+			 * the frames needed to see the missing errors at the current FER.
+			 */
+			remaining = (frames < max_frames) ? static_cast<double>(max_frames - frames) : 0.0;
+			if (frame_errors >= max_errors)
+				remaining = 0.0;
+			else if (frame_errors > 0)
+				remaining = min(remaining, (max_errors - frame_errors) * static_cast<double>(frames) / frame_errors);
+		}
+		else
+		{
+			/*
+			 * With importance sampling the unweighted counts are biased, the
+			 * weighted estimates are reported and the point stops at the limits
+			 * of the weighted error rates: the maximum number of frames or the
+			 * target relative error, which shrinks with the square root of the
+			 * number of frames.
+			 */
+			double relative_error = weighted->error_rate_blocks_relative_error().Read();
+			double max_relative_error = weighted->max_relative_error();
+
+			frames       = weighted->num_total_blocks().Read();
+			frame_errors = weighted->num_diff_blocks().Read();
+			max_frames   = weighted->max_num_total_blocks();
+			fer          = weighted->error_rate_blocks().Read();
+			ber          = weighted->error_rate_bits().Read();
+			Normal_Interval(fer, weighted->error_rate_blocks_variance().Read(), confidence(), fer_lower, fer_upper);
+			Normal_Interval(ber, weighted->error_rate_bits_variance().Read(), confidence(), ber_lower, ber_upper);
+
+			remaining = (frames < max_frames) ? static_cast<double>(max_frames - frames) : 0.0;
+			if (max_relative_error > 0 && relative_error > 0 && frame_errors > 0)
+			{
+				double needed = frames * (relative_error / max_relative_error) * (relative_error / max_relative_error);
+				needed = max(needed, static_cast<double>(frames) * weighted->min_num_diff_blocks() / frame_errors);
+				remaining = min(remaining, max(0.0, needed - frames));
+			}
+		}
+
+		// Confidence-based stopping ends the point at its target precision.
+		if (confidence_stop != NULL)
+		{
+			double confidence_remaining = confidence_stop->Remaining_Frames();
+
+			if (confidence_remaining >= 0)
+				remaining = min(remaining, confidence_remaining);
+		}
+
+		double progress = (frames + remaining > 0) ? frames / (frames + remaining) : 1.0;
+
+		// The remaining time follows the whole frame loop, the rates the decoder alone.
+		double loop_frames_per_second = (wall > 0) ? throughput.frames() / wall : 0.0;
+		double frames_per_second = (decoder_wall > 0) ? throughput.frames() / decoder_wall : 0.0;
+
+		// Estimated time until the stopping criterion, -1 if unknown, at most the time budget.
+		double eta = (loop_frames_per_second > 0) ? remaining / loop_frames_per_second : -1.0;
+		if (confidence_stop != NULL)
+		{
+			double budget_remaining = confidence_stop->Remaining_Time();
+
+			if (budget_remaining >= 0)
+				eta = (eta >= 0) ? min(eta, budget_remaining) : budget_remaining;
+		}
+
+		os << (i ? ",\n" : "\n");
+		os << "    {\n";
+		os << "      \"name\": ";
+		Write_String(os, error_rates.instance_name());
+		os << ",\n";
+		os << "      \"iteration\": " << iteration << ",\n";
+		os << "      \"frames\": " << frames << ",\n";
+		os << "      \"frame_errors\": " << frame_errors << ",\n";
+		os << "      \"fer\": " << fer << ",\n";
+		os << "      \"fer_interval\": [" << fer_lower << ", " << fer_upper << "],\n";
+		os << "      \"bits\": " << bits << ",\n";
+		os << "      \"bit_errors\": " << bit_errors << ",\n";
+		os << "      \"ber\": " << ber << ",\n";
+		os << "      \"ber_interval\": [" << ber_lower << ", " << ber_upper << "],\n";
+		os << "      \"max_frames\": " << max_frames << ",\n";
+		os << "      \"max_frame_errors\": " << max_errors << ",\n";
+		os << "      \"progress\": " << progress << ",\n";
+		os << "      \"frames_per_second\": " << frames_per_second << ",\n";
+		os << "      \"info_bits_per_second\": " << ((decoder_wall > 0) ? throughput.info_bits() / decoder_wall : 0.0) << ",\n";
+		os << "      \"eta_s\": ";
+		if (eta >= 0)
+			os << eta << "\n";
+		else
+			os << "null\n";
+		os << "    }";
+	}
+	os << (watch_list_.empty() ? "]\n" : "\n  ]\n");
+	os << "}\n";
+	os.close();
+
+	// Replace the status file atomically.
+	if (os.fail() || rename(tmp_name.c_str(), file_name().c_str()) != 0)
+		Msg(WARNING, instance_name(), "Cannot write status file " + file_name() + "!");
+}
+}
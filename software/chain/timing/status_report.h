@@ -0,0 +1,120 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Machine-readable progress report of a simulation
+/// \date   2026/10/19
+//
+
+#ifndef STATUS_REPORT_H_
+#define STATUS_REPORT_H_
+
+#include <vector>
+#include <string>
+#include <iosfwd>
+
+#include "status_report_param.h"
+#include "stat_throughput.h"
+#include "stat_confidence.h"
+#include "stat_weighted_error_rates.h"
+
+
+namespace cse_lib {
+
+/// Periodic JSON status file of a running simulation
+/**
+ * Writes the current simulation point, the frame and error counts, FER and
+ * BER with their Wilson confidence intervals, the throughput and the
+ * estimated time until the stopping criterion of each watched error rate
+ * statistics to file_name. The file is written to a temporary file first and
+ * renamed, so a reader never sees a partial file.
+ *
+ * Begin_Point() starts a simulation point, Watch() adds the statistics of a
+ * decoder, Run() is called once per frame and updates the file at most every
+ * interval seconds. End_Point() and Finish() update the file immediately.
+ *
+ * If the decoder is stopped by a Statistics_Confidence as well, the estimated
+ * time is clamped to its precision target and its time budget. With importance
+ * sampling the FER, the BER and their intervals are those of the
+ * Statistics_Weighted_Error_Rates, and the estimated time follows its limits.
+ *
+ * \ingroup modules
+ */
+class Status_Report : public Status_Report_Parameter
+{
+
+public:
+
+	/// Error rate statistics that can be watched
+	typedef Statistics_Error_Rates<2> Error_Rates_Type;
+
+	Status_Report();
+
+	virtual ~Status_Report() { }
+
+	/// Update the status file if the interval has elapsed.
+	int Run()
+	{
+		if (enabled() && Read_Time() >= next_update_)
+			Write_Status("running");
+		return 0;
+	}
+
+	/// Start a new simulation point, the values of the iteration variables identify the point.
+	void Begin_Point(Manage_Module_Config& xml_config);
+
+	/// Report the statistics of a decoder for the current simulation point.
+	/**
+	 * \param error_rates Error rate statistics of the decoder.
+	 * \param iteration   Port address of the error counts to report, e.g. the last iteration.
+	 * \param throughput  Throughput statistics of the decoder.
+	 * \param confidence  Confidence-based stopping of the decoder, NULL if none.
+	 * \param weighted_error_rates Weighted error rates of the decoder under importance sampling, NULL if none.
+	 */
+	void Watch(Error_Rates_Type& error_rates, unsigned int iteration, Statistics_Throughput& throughput,
+	           Statistics_Confidence *confidence = NULL,
+	           Statistics_Weighted_Error_Rates *weighted_error_rates = NULL);
+
+	/// The current simulation point is finished.
+	void End_Point();
+
+	/// The simulation is finished.
+	void Finish();
+
+private:
+
+	/// Statistics of one decoder
+	struct Watch_Entry
+	{
+		Error_Rates_Type      *error_rates;
+		unsigned int           iteration;
+		Statistics_Throughput *throughput;
+		Statistics_Confidence *confidence;
+		Statistics_Weighted_Error_Rates *weighted_error_rates;
+	};
+
+	/// Read the monotonic clock in seconds.
+	static double Read_Time();
+
+	/// Write a string as JSON string.
+	static void Write_String(std::ostream& os, const std::string& str);
+
+	/// Write the status file with the given state.
+	void Write_Status(const std::string& state);
+
+	std::vector<Watch_Entry> watch_list_;
+
+	/// Names and values of the iteration variables of the current point
+	std::vector<std::string> point_names_;
+	std::vector<std::string> point_values_;
+
+	/// Index of the current simulation point
+	int point_index_;
+
+	double start_time_;
+	double point_start_time_;
+	double next_update_;
+};
+}
+#endif // STATUS_REPORT_H_
@@ -0,0 +1,81 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Parameters of the status report
+/// \date   2026/10/19
+//
+
+#ifndef STATUS_REPORT_PARAM_H_
+#define STATUS_REPORT_PARAM_H_
+
+#include "cse_lib.h"
+
+
+namespace cse_lib {
+
+/// Parameter class of the status report
+/**
+ * \ingroup parameter
+ */
+class Status_Report_Parameter : public Base_Parameter
+{
+
+public:
+
+	Status_Report_Parameter()
+	{
+		instance_name(Unique_ID());
+		Set_Default_Values();
+	}
+
+	virtual ~Status_Report_Parameter(){}
+
+	/// Unique identification string of the module.
+	static std::string Unique_ID(){ return "Status_Report";}
+
+
+	/**************
+	 * Parameters *
+	 **************/
+
+	/// Write the status file.
+	Param<bool> enabled;
+
+	/// Name of the JSON status file, replaced atomically on each update
+	Param<raw_string> file_name;
+
+	/// Minimum time between two updates of the status file in seconds
+	Param<float> interval;
+
+	/// Confidence level of the error rate intervals
+	Param<float> confidence;
+
+
+protected:
+
+
+	/******************
+	 * Default values *
+	 ******************/
+
+	/// Set all parameters to their default values.
+	/**
+	 * Default values:
+	 *  - enabled    : false
+	 *  - file_name  : status.json
+	 *  - interval   : 10.0
+	 *  - confidence : 0.95
+	 */
+	void Set_Default_Values()
+	{
+		enabled.Init(false, "enabled", param_list_);
+		file_name.Init("status.json", "file_name", param_list_);
+		interval.Init(10.0, "interval", param_list_);
+		confidence.Init(0.95, "confidence", param_list_);
+	}
+
+};
+}
+#endif // STATUS_REPORT_PARAM_H_
@@ -0,0 +1,588 @@
+/*
+ * ldpc_bench.cpp
+ *
+ * Microbenchmarks of the LDPC decoder kernels and the chain modules.
+ *
+ * Measures the check node functions of all CHECK_NODE_ENUM algorithms, the
+ * decoder iterations (layered, two-phase, layered superposed), Init_APP_RAM,
+ * Read_APP_RAM and the Run() of each chain module. All inputs are generated
+ * from fixed seeds, so two runs of the same binary process the same data.
+ * Each case is run for a number of warmup repetitions before the timed
+ * repetitions, the median and the minimum of the timed repetitions are
+ * reported as JSON. If built with LDPC_PERF_COUNTERS, the decoding cases
+ * additionally report the hardware performance counters of the gather,
+ * check node and scatter phases per op.
+ *
+ * Usage: ldpc_bench [-code <0..3>] [-es_n0 <dB>] [-iterations <n>]
+ *                   [-warmup <n>] [-reps <n>] [-cpu <core>]
+ *                   [-tag <string>] [-o <file>]
+ *
+ *   -code        LDPC code, index of LDPC_CODE (default: 0, R050)
+ *   -es_n0       Es/N0 of the channel in dB (default: 2.0)
+ *   -iterations  Decoder iterations per decoding run (default: 5)
+ *   -warmup      Untimed repetitions of each case (default: 20)
+ *   -reps        Timed repetitions of each case (default: 200)
+ *   -cpu         Pin the process to this core, -1 disables pinning (default: 0)
+ *   -tag         Free text stored in the report, e.g., the commit to compare
+ *   -o           Write the report to this file instead of stdout
+ */
+
+#include "../../cse/include/cse_lib.h"
+#include "../ldpc_enc/enc_ldpc_ieee_802_11ad.h"
+#include "../ldpc_dec/dec_ldpc_ieee_802_11ad.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <cmath>
+#include <ctime>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+using namespace cse_lib;
+using namespace std;
+
+
+/// Monotonic time in nanoseconds.
+static double Now_Ns()
+{
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+
+/// Pin the process to a single core, returns false if not possible.
+static bool Pin_To_Core(int core)
+{
+#ifdef __linux__
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	CPU_SET(core, &cpu_set);
+	return sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0;
+#else
+	return false;
+#endif
+}
+
+
+/// Names of the check node algorithms as used in the configuration files.
+static const char* Algorithm_Name(Decoder_LDPC_Binary_HW_Share::CHECK_NODE_ENUM algorithm)
+{
+	switch(algorithm)
+	{
+	case Decoder_LDPC_Binary_HW_Share::LAMBDA_MIN:                return "LAMBDA_MIN";
+	case Decoder_LDPC_Binary_HW_Share::MIN_SUM:                   return "MIN_SUM";
+	case Decoder_LDPC_Binary_HW_Share::MIN_SUM_SELF_CORRECTING:   return "MIN_SUM_SELF_CORRECTING";
+	case Decoder_LDPC_Binary_HW_Share::SPLIT_ROW:                 return "SPLIT_ROW";
+	case Decoder_LDPC_Binary_HW_Share::SPLIT_ROW_IMPROVED:        return "SPLIT_ROW_IMPROVED";
+	case Decoder_LDPC_Binary_HW_Share::SPLIT_ROW_SELF_CORRECTING: return "SPLIT_ROW_SELF_CORRECTING";
+	}
+	return "UNKNOWN";
+}
+
+
+/// Decoder with access to the kernels of the share.
+class Decoder_LDPC_Bench : public Decoder_LDPC_IEEE_802_11ad
+{
+
+public:
+
+	/// Decoder functions that can be benchmarked as a whole iteration.
+	enum DECODE_ENUM {LAYERED, TWO_PHASE, LAYERED_SUPERPOSED};
+
+	/// Parameterize the decoder and allocate the RAMs.
+	void Configure()
+	{
+		Init();
+		app_ram_.Resize(dst_parallelism_, num_variable_nodes_ / dst_parallelism_);
+		msg_ram_.Resize(dst_parallelism_, num_check_nodes_ * max_check_degree_ / dst_parallelism_);
+		check_node_io_.Resize(num_check_nodes_, max_check_degree_);
+		check_node_in_.Resize(num_check_nodes_, max_check_degree_);
+	}
+
+	unsigned int Num_Variable_Nodes() { return num_variable_nodes_; }
+	unsigned int Num_Check_Nodes()    { return num_check_nodes_; }
+
+	/// Number of edges of the Tanner graph (used entries of the address vector).
+	unsigned int Num_Edges()
+	{
+		unsigned int num_edges = 0;
+		for (unsigned int i = 0; i < num_check_nodes_ / dst_parallelism_ * max_check_degree_; i++)
+			if (addr_vector_[i] >= 0)
+				num_edges += dst_parallelism_;
+		return num_edges;
+	}
+
+	/// Load the channel values into the APP RAM and clear the extrinsic RAM.
+	void Load(Buffer<int> &input_bits_llr)
+	{
+		Init_APP_RAM(is_IRA_code_, input_bits_llr, app_ram_);
+		msg_ram_.Clear();
+	}
+
+	/// Read the APP RAM as after the first iteration.
+	void Read()
+	{
+		Read_APP_RAM(app_ram_, 0, output_bits_llr_app(), output_bits());
+	}
+
+	/// Decode the loaded frame for num_iterations() iterations without early stopping.
+	void Decode(DECODE_ENUM decode)
+	{
+		for (unsigned int iter = 0; iter < num_iterations(); iter++)
+		{
+			switch(decode)
+			{
+			case LAYERED:
+				Decode_Layered(app_ram_, msg_ram_, iter);
+				break;
+			case TWO_PHASE:
+				Decode_Two_Phase(app_ram_, msg_ram_, iter, app_parity_check());
+				break;
+			case LAYERED_SUPERPOSED:
+				Decode_Layered_Superposed(app_ram_, msg_ram_, iter);
+				break;
+			}
+		}
+	}
+
+	/// Store the check node inputs of the first iteration of a frame.
+	void Capture_Check_Node_Inputs(Buffer<int> &input_bits_llr)
+	{
+		Buffer<int> app_out(max_check_degree_);
+
+		// One iteration sets up the check node buffers of the share.
+		Load(input_bits_llr);
+		Decode_Layered(app_ram_, msg_ram_, 0);
+
+		Load(input_bits_llr);
+		for (unsigned int cng_counter = 0; cng_counter < num_check_nodes_ / dst_parallelism_; cng_counter++)
+			for (unsigned int cfu_counter = 0; cfu_counter < dst_parallelism_; cfu_counter++)
+				Get_Check_Node_Input(app_ram_, msg_ram_, 0, cng_counter, cfu_counter,
+				                     check_node_in_[cng_counter * dst_parallelism_ + cfu_counter], app_out);
+	}
+
+	/// Restore the captured check node inputs.
+	void Reset_Check_Nodes()
+	{
+		check_node_io_ = check_node_in_;
+	}
+
+#ifdef LDPC_PERF_COUNTERS
+	/// Clear the performance counters of the decoder phases.
+	void Reset_Perf_Counters() { perf_counters_.Reset(); }
+
+	/// Performance counters per op as JSON object.
+	string Perf_Counters_Json(unsigned int ops)
+	{
+		ostringstream json;
+		json << "{";
+		for (unsigned int p = 0; p < Decoder_LDPC_Perf_Counters::NUM_PHASES; p++)
+		{
+			json << (p ? ", " : "") << "\"" << Decoder_LDPC_Perf_Counters::Phase_Name(p) << "\": {";
+			for (unsigned int e = 0; e < Decoder_LDPC_Perf_Counters::NUM_EVENTS; e++)
+				json << "\"" << Decoder_LDPC_Perf_Counters::Event_Name(e) << "\": "
+				     << static_cast<double>(perf_counters_.Count(p, e)) / ops << ", ";
+			json << "\"ipc\": " << perf_counters_.IPC(p) << "}";
+		}
+		json << "}";
+		return json.str();
+	}
+#endif
+
+	/// Run the selected check node algorithm on all captured inputs.
+	void Run_Check_Nodes()
+	{
+		const unsigned int *esf_lut = Get_Esf_Lut(0);
+
+		for (unsigned int cng_counter = 0; cng_counter < num_check_nodes_ / dst_parallelism_; cng_counter++)
+			for (unsigned int cfu_counter = 0; cfu_counter < dst_parallelism_; cfu_counter++)
+				Check_Node(check_node_io_[cng_counter * dst_parallelism_ + cfu_counter],
+				           cng_counter, cfu_counter, esf_lut);
+	}
+
+private:
+
+	Buffer<int, 2> app_ram_;        ///< APP RAM
+	Buffer<int, 2> msg_ram_;        ///< Extrinsic RAM
+	Buffer<int, 2> check_node_in_;  ///< Captured check node inputs, one row per check node
+	Buffer<int, 2> check_node_io_;  ///< Working copy of the check node inputs
+};
+
+
+/// A benchmark case, Prepare() is not timed, Execute() is.
+class Bench_Case
+{
+
+public:
+
+	Bench_Case(const string &name, double edges_per_op, double bits_per_op)
+	: name_(name), edges_per_op_(edges_per_op), bits_per_op_(bits_per_op) { }
+
+	virtual ~Bench_Case() { }
+
+	virtual void Prepare() { }
+	virtual void Execute() = 0;
+
+	/// Called before the timed repetitions.
+	virtual void Start_Timing() { }
+
+	/// Additional JSON members of the result, e.g., performance counters.
+	virtual string Extra_Json(unsigned int reps) { return ""; }
+
+	string name_;
+	double edges_per_op_;  ///< Processed edges per Execute(), 0 if not applicable
+	double bits_per_op_;   ///< Processed codeword bits per Execute()
+};
+
+
+/// Run() of a chain module.
+template<class T>
+class Bench_Module : public Bench_Case
+{
+
+public:
+
+	Bench_Module(const string &name, T &module, double bits_per_op)
+	: Bench_Case(name, 0, bits_per_op), module_(module) { }
+
+	void Execute() { module_.Run(); }
+
+private:
+	T &module_;
+};
+
+
+/// Check node function on the captured check node inputs.
+class Bench_Check_Node : public Bench_Case
+{
+
+public:
+
+	Bench_Check_Node(const string &name, Decoder_LDPC_Bench &decoder)
+	: Bench_Case(name, decoder.Num_Edges(), decoder.Num_Variable_Nodes()), decoder_(decoder) { }
+
+	void Prepare() { decoder_.Reset_Check_Nodes(); }
+	void Execute() { decoder_.Run_Check_Nodes(); }
+
+private:
+	Decoder_LDPC_Bench &decoder_;
+};
+
+
+/// Decoding of a frame with num_iterations() iterations.
+class Bench_Decode : public Bench_Case
+{
+
+public:
+
+	Bench_Decode(const string &name, Decoder_LDPC_Bench &decoder,
+	             Decoder_LDPC_Bench::DECODE_ENUM decode, Buffer<int> &input_bits_llr)
+	: Bench_Case(name,
+	             static_cast<double>(decoder.Num_Edges()) * decoder.num_iterations(),
+	             decoder.Num_Variable_Nodes()),
+	  decoder_(decoder), decode_(decode), input_bits_llr_(input_bits_llr) { }
+
+	void Prepare() { decoder_.Load(input_bits_llr_); }
+	void Execute() { decoder_.Decode(decode_); }
+
+#ifdef LDPC_PERF_COUNTERS
+	void Start_Timing() { decoder_.Reset_Perf_Counters(); }
+	string Extra_Json(unsigned int reps) { return ", \"perf_per_op\": " + decoder_.Perf_Counters_Json(reps); }
+#endif
+
+private:
+	Decoder_LDPC_Bench &decoder_;
+	Decoder_LDPC_Bench::DECODE_ENUM decode_;
+	Buffer<int> &input_bits_llr_;
+};
+
+
+/// Init_APP_RAM of a frame.
+class Bench_Init_APP_RAM : public Bench_Case
+{
+
+public:
+
+	Bench_Init_APP_RAM(const string &name, Decoder_LDPC_Bench &decoder, Buffer<int> &input_bits_llr)
+	: Bench_Case(name, 0, decoder.Num_Variable_Nodes()), decoder_(decoder), input_bits_llr_(input_bits_llr) { }
+
+	void Execute() { decoder_.Load(input_bits_llr_); }
+
+private:
+	Decoder_LDPC_Bench &decoder_;
+	Buffer<int> &input_bits_llr_;
+};
+
+
+/// Read_APP_RAM of a frame.
+class Bench_Read_APP_RAM : public Bench_Case
+{
+
+public:
+
+	Bench_Read_APP_RAM(const string &name, Decoder_LDPC_Bench &decoder)
+	: Bench_Case(name, 0, decoder.Num_Variable_Nodes()), decoder_(decoder) { }
+
+	void Execute() { decoder_.Read(); }
+
+private:
+	Decoder_LDPC_Bench &decoder_;
+};
+
+
+/// Timing result of a benchmark case.
+struct Bench_Result
+{
+	string name;
+	double ns_median;
+	double ns_min;
+	double edges_per_op;
+	double bits_per_op;
+	string extra_json;
+};
+
+
+/// Run a case with warmup, returns median and minimum of the timed repetitions.
+static Bench_Result Run_Case(Bench_Case &bench, unsigned int warmup, unsigned int reps)
+{
+	vector<double> times(reps);
+	double start;
+
+	for (unsigned int i = 0; i < warmup; i++)
+	{
+		bench.Prepare();
+		bench.Execute();
+	}
+
+	bench.Start_Timing();
+	for (unsigned int i = 0; i < reps; i++)
+	{
+		bench.Prepare();
+		start = Now_Ns();
+		bench.Execute();
+		times[i] = Now_Ns() - start;
+	}
+
+	sort(times.begin(), times.end());
+
+	Bench_Result result;
+	result.name         = bench.name_;
+	result.ns_median    = times[reps / 2];
+	result.ns_min       = times[0];
+	result.edges_per_op = bench.edges_per_op_;
+	result.bits_per_op  = bench.bits_per_op_;
+	result.extra_json   = bench.Extra_Json(reps);
+	return result;
+}
+
+
+/// Write the results as JSON.
+static void Write_Json(ostream &out, const string &tag, const string &code, double es_n0,
+                       unsigned int iterations, int cpu, bool pinned,
+                       unsigned int warmup, unsigned int reps,
+                       const vector<Bench_Result> &results)
+{
+	out << "{" << endl;
+	out << "  \"tag\": \"" << tag << "\"," << endl;
+	out << "  \"ldpc_code\": \"" << code << "\"," << endl;
+	out << "  \"es_n0\": " << es_n0 << "," << endl;
+	out << "  \"iterations\": " << iterations << "," << endl;
+	out << "  \"cpu\": " << cpu << "," << endl;
+	out << "  \"pinned\": " << (pinned ? "true" : "false") << "," << endl;
+	out << "  \"warmup\": " << warmup << "," << endl;
+	out << "  \"repetitions\": " << reps << "," << endl;
+	out << "  \"results\": [" << endl;
+
+	for (unsigned int i = 0; i < results.size(); i++)
+	{
+		const Bench_Result &r = results[i];
+
+		out << "    {\"name\": \"" << r.name << "\""
+		    << ", \"ns_per_op\": " << r.ns_median
+		    << ", \"ns_per_op_min\": " << r.ns_min;
+		if (r.edges_per_op > 0)
+			out << ", \"ns_per_edge\": " << r.ns_median / r.edges_per_op;
+		out << ", \"mbit_per_s\": " << (r.ns_median > 0 ? r.bits_per_op * 1e3 / r.ns_median : 0)
+		    << r.extra_json << "}" << (i + 1 < results.size() ? "," : "") << endl;
+	}
+
+	out << "  ]" << endl;
+	out << "}" << endl;
+}
+
+
+int main(int argc, char *argv[])
+{
+	unsigned int code       = 0;
+	double       es_n0      = 2.0;
+	unsigned int iterations = 5;
+	unsigned int warmup     = 20;
+	unsigned int reps       = 200;
+	int          cpu        = 0;
+	string       tag;
+	string       out_file;
+
+	for (int i = 1; i < argc; i++)
+	{
+		string arg = argv[i];
+
+		if (i + 1 >= argc)
+		{
+			cerr << "Missing value for " << arg << endl;
+			return 1;
+		}
+
+		if      (arg == "-code")       code       = atoi(argv[++i]);
+		else if (arg == "-es_n0")      es_n0      = atof(argv[++i]);
+		else if (arg == "-iterations") iterations = atoi(argv[++i]);
+		else if (arg == "-warmup")     warmup     = atoi(argv[++i]);
+		else if (arg == "-reps")       reps       = atoi(argv[++i]);
+		else if (arg == "-cpu")        cpu        = atoi(argv[++i]);
+		else if (arg == "-tag")        tag        = argv[++i];
+		else if (arg == "-o")          out_file   = argv[++i];
+		else
+		{
+			cerr << "Usage: " << argv[0] << " [-code <0..3>] [-es_n0 <dB>] [-iterations <n>]"
+			     << " [-warmup <n>] [-reps <n>] [-cpu <core>] [-tag <string>] [-o <file>]" << endl;
+			return 1;
+		}
+	}
+
+	if (code > Decoder_LDPC_IEEE_802_11ad::IEEE_802_11AD_P42_N672_R081 || reps == 0 || iterations == 0)
+	{
+		cerr << "Invalid code, repetitions or iterations!" << endl;
+		return 1;
+	}
+
+	bool pinned = false;
+	if (cpu >= 0)
+	{
+		pinned = Pin_To_Core(cpu);
+		if (!pinned)
+			cerr << "Warning: cannot pin to core " << cpu << ", timings may be noisy." << endl;
+	}
+
+	vector<Bench_Result> results;
+	string code_name;
+
+	try
+	{
+		// Chain as in WPAN_chain with QPSK, fixed seeds and fixed noise.
+		Source_Bits source_bits;
+		Encoder_LDPC_IEEE_802_11ad encoder;
+		Mapper mapper;
+		Channel_AWGN channel;
+		Demapper demapper;
+		Converter_Float_Fixpoint<float, int> converter;
+		Decoder_LDPC_Bench decoder;
+
+		float noise_variance = static_cast<float>(pow(10.0, -es_n0 / 10.0));
+
+		encoder.ldpc_code(static_cast<Encoder_LDPC_IEEE_802_11ad::LDPC_CODE>(code));
+		decoder.ldpc_code(static_cast<Decoder_LDPC_IEEE_802_11ad::LDPC_CODE>(code));
+		decoder.num_iterations(iterations);
+		decoder.Configure();
+
+		unsigned int num_bits = decoder.Num_Variable_Nodes() - decoder.Num_Check_Nodes();
+		double code_bits = decoder.Num_Variable_Nodes();
+
+		source_bits.num_bits(num_bits);
+		source_bits.start_seed(1);
+		mapper.mapping(Mapper_Share::MAP_QPSK);
+		channel.noise_variance(noise_variance);
+		channel.start_seed(1);
+		demapper.mapping(Mapper_Share::MAP_QPSK);
+		demapper.noise_variance(noise_variance);
+		converter.bw_output(6);
+		converter.bw_output_fract(2);
+
+		encoder.input_bits(source_bits.output_bits());
+		mapper.input_bits(encoder.output_bits());
+		channel.input_symb(mapper.output_symb());
+		demapper.input_symb(channel.output_symb());
+		converter.input(demapper.output_bits_llr());
+		decoder.input_bits_llr(converter.output());
+
+		// Chain modules, each one processes the output of the previous one.
+		Bench_Module<Source_Bits> bench_source("Source_Bits", source_bits, num_bits);
+		Bench_Module<Encoder_LDPC_IEEE_802_11ad> bench_encoder("Encoder_LDPC_IEEE_802_11ad", encoder, code_bits);
+		Bench_Module<Mapper> bench_mapper("Mapper", mapper, code_bits);
+		Bench_Module<Channel_AWGN> bench_channel("Channel_AWGN", channel, code_bits);
+		Bench_Module<Demapper> bench_demapper("Demapper", demapper, code_bits);
+		Bench_Module<Converter_Float_Fixpoint<float, int> > bench_converter("Converter_Float_Fixpoint", converter, code_bits);
+
+		results.push_back(Run_Case(bench_source,    warmup, reps));
+		results.push_back(Run_Case(bench_encoder,   warmup, reps));
+		results.push_back(Run_Case(bench_mapper,    warmup, reps));
+		results.push_back(Run_Case(bench_channel,   warmup, reps));
+		results.push_back(Run_Case(bench_demapper,  warmup, reps));
+		results.push_back(Run_Case(bench_converter, warmup, reps));
+
+		// All decoder cases work on the last frame of the chain.
+		Buffer<int> input_bits_llr;
+		input_bits_llr = converter.output();
+
+		Bench_Init_APP_RAM bench_init("Init_APP_RAM", decoder, input_bits_llr);
+		results.push_back(Run_Case(bench_init, warmup, reps));
+
+		decoder.Load(input_bits_llr);
+		Bench_Read_APP_RAM bench_read("Read_APP_RAM", decoder);
+		results.push_back(Run_Case(bench_read, warmup, reps));
+
+		// Check node kernels on the inputs of the first iteration.
+		for (unsigned int a = Decoder_LDPC_Binary_HW_Share::LAMBDA_MIN;
+		     a <= Decoder_LDPC_Binary_HW_Share::SPLIT_ROW_SELF_CORRECTING; a++)
+		{
+			Decoder_LDPC_Binary_HW_Share::CHECK_NODE_ENUM algorithm =
+				static_cast<Decoder_LDPC_Binary_HW_Share::CHECK_NODE_ENUM>(a);
+
+			decoder.dec_algorithm(algorithm);
+			decoder.Configure();
+			decoder.Capture_Check_Node_Inputs(input_bits_llr);
+
+			Bench_Check_Node bench_cn(string("Check_Node_") + Algorithm_Name(algorithm), decoder);
+			results.push_back(Run_Case(bench_cn, warmup, reps));
+		}
+
+		// Decoder iterations with Min-Sum.
+		decoder.dec_algorithm(Decoder_LDPC_Binary_HW_Share::MIN_SUM);
+		decoder.Configure();
+
+		Bench_Decode bench_layered("Decode_Layered", decoder, Decoder_LDPC_Bench::LAYERED, input_bits_llr);
+		Bench_Decode bench_two_phase("Decode_Two_Phase", decoder, Decoder_LDPC_Bench::TWO_PHASE, input_bits_llr);
+		Bench_Decode bench_superposed("Decode_Layered_Superposed", decoder, Decoder_LDPC_Bench::LAYERED_SUPERPOSED, input_bits_llr);
+
+		results.push_back(Run_Case(bench_layered,    warmup, reps));
+		results.push_back(Run_Case(bench_two_phase,  warmup, reps));
+		results.push_back(Run_Case(bench_superposed, warmup, reps));
+
+		code_name = decoder.ldpc_code.Get_Link_String();
+	}
+	catch(exception &e)
+	{
+		cerr << e.what() << endl;
+		return 1;
+	}
+
+	if (out_file.empty())
+		Write_Json(cout, tag, code_name, es_n0, iterations, cpu, pinned, warmup, reps, results);
+	else
+	{
+		ofstream out(out_file.c_str());
+		if (!out)
+		{
+			cerr << "Cannot write " << out_file << endl;
+			return 1;
+		}
+		Write_Json(out, tag, code_name, es_n0, iterations, cpu, pinned, warmup, reps, results);
+	}
+
+	return 0;
+}
@@ -0,0 +1,168 @@
+/*
+ * ldpc_encoder_check.cpp
+ *
+ * Encodes random frames for all IEEE 802.11ad LDPC codes with the encoder
+ * functions of Encoder_LDPC_Binary_Struct_Share (Encode_Binary_Lower_Triangular,
+ * Encode_Binary_Lower_Triangular_Packed and Encode_Binary_Generator) and checks
+ * that all of them return the same code word and that every code word
+ * satisfies all parity checks of H_. The frames are generated from a fixed
+ * seed, so two runs check the same data.
+ *
+ * Usage: ldpc_encoder_check [<frames per code>]  (default: 1000)
+ * Returns 0 if all code words match and have a zero syndrome, 1 otherwise.
+ */
+
+#include "../../cse/include/cse_lib.h"
+#include "../ldpc_enc/enc_ldpc_ieee_802_11ad.h"
+
+#include <iostream>
+#include <cstdlib>
+
+using namespace cse_lib;
+using namespace std;
+
+
+/// Encoder with access to the encoder functions of the share.
+class Encoder_LDPC_Check : public Encoder_LDPC_IEEE_802_11ad
+{
+
+public:
+
+	/// Names of the codes as used in the configuration files.
+	static const char* Code_Name(LDPC_CODE code)
+	{
+		switch(code)
+		{
+		case IEEE_802_11AD_P42_N672_R050: return "IEEE_802_11AD_P42_N672_R050";
+		case IEEE_802_11AD_P42_N672_R062: return "IEEE_802_11AD_P42_N672_R062";
+		case IEEE_802_11AD_P42_N672_R075: return "IEEE_802_11AD_P42_N672_R075";
+		case IEEE_802_11AD_P42_N672_R081: return "IEEE_802_11AD_P42_N672_R081";
+		}
+		return "UNKNOWN";
+	}
+
+	/// Number of parity checks of the code word that are not satisfied.
+	unsigned int Syndrome_Weight(const Buffer<unsigned int> &code_bits) const
+	{
+		u_int num_vngs = k_b_ + m_b_;
+		unsigned int weight = 0;
+		int h_entry;
+
+		for (u_int cng = 0; cng < m_b_; cng++)
+			for (u_int edge_cnt = 0; edge_cnt < z_; edge_cnt++)
+			{
+				unsigned int parity = 0;
+
+				for (u_int vng = 0; vng < num_vngs; vng++)
+				{
+					h_entry = *(H_ + cng * num_vngs + vng);
+
+					if (h_entry > -1)
+						parity ^= code_bits[vng * z_ + (h_entry + edge_cnt) % z_];
+				}
+
+				weight += parity;
+			}
+
+		return weight;
+	}
+
+	/// Encode num_frames random frames of the given code, returns the number of failing frames.
+	unsigned int Check(LDPC_CODE code, unsigned int num_frames)
+	{
+		Buffer<unsigned int> info_bits;
+		Buffer<packed_bit>   info_bits_packed;
+		Buffer<unsigned int> code_bits_lt;
+		Buffer<packed_bit>   code_bits_lt_packed;
+		Buffer<packed_bit>   code_bits_gen_packed;
+		Buffer<unsigned int> code_bits_lt_unpacked;
+		Buffer<unsigned int> code_bits_gen;
+
+		unsigned int mismatches = 0;
+		unsigned int syndrome_errors = 0;
+
+		// Configure the code with one Run() of the encoder on an empty frame.
+		ldpc_code(code);
+		encoding(LOWER_TRIANGULAR);
+		input_bits(info_bits);
+		Run();
+
+		info_bits.Resize(k_b_ * z_);
+		code_bits_lt.Resize((k_b_ + m_b_) * z_);
+		code_bits_lt_packed.Resize((k_b_ + m_b_) * z_);
+		code_bits_gen_packed.Resize((k_b_ + m_b_) * z_);
+
+		Init_Generator();
+
+		for (unsigned int frame = 0; frame < num_frames; frame++)
+		{
+			for (unsigned int i = 0; i < info_bits.length(); i++)
+				info_bits[i] = rand() & 1;
+
+			info_bits_packed.Pack(info_bits);
+
+			Encode_Binary_Lower_Triangular(info_bits, code_bits_lt);
+			Encode_Binary_Lower_Triangular_Packed(info_bits_packed, code_bits_lt_packed);
+			Encode_Binary_Generator(info_bits_packed, code_bits_gen_packed);
+
+			code_bits_lt_packed.Unpack(code_bits_lt_unpacked);
+			code_bits_gen_packed.Unpack(code_bits_gen);
+
+			bool match = true;
+			for (unsigned int i = 0; i < code_bits_lt.length(); i++)
+				if (code_bits_lt[i] != code_bits_lt_unpacked[i] || code_bits_lt[i] != code_bits_gen[i])
+					match = false;
+
+			for (unsigned int i = 0; i < info_bits.length(); i++)
+				if (code_bits_lt[i] != info_bits[i])
+					match = false;
+
+			if (!match)
+				mismatches++;
+
+			if (Syndrome_Weight(code_bits_lt) != 0 || Syndrome_Weight(code_bits_gen) != 0)
+				syndrome_errors++;
+		}
+
+		cout << Code_Name(code) << ": " << num_frames << " frames, "
+		     << mismatches << " mismatches, "
+		     << syndrome_errors << " nonzero syndromes" << endl;
+
+		return mismatches + syndrome_errors;
+	}
+};
+
+
+int main(int argc, char *argv[])
+{
+	unsigned int failures = 0;
+	unsigned int num_frames = 1000;
+
+	if (argc > 2)
+	{
+		cerr << "Usage: " << argv[0] << " [<frames per code>]" << endl;
+		return 1;
+	}
+
+	if (argc == 2)
+		num_frames = atoi(argv[1]);
+
+	srand(1);
+
+	try
+	{
+		for (int code = Encoder_LDPC_Check::IEEE_802_11AD_P42_N672_R050;
+		     code <= Encoder_LDPC_Check::IEEE_802_11AD_P42_N672_R081; code++)
+		{
+			Encoder_LDPC_Check encoder;
+			failures += encoder.Check(static_cast<Encoder_LDPC_Check::LDPC_CODE>(code), num_frames);
+		}
+	}
+	catch(exception &e)
+	{
+		cerr << e.what() << endl;
+		return 1;
+	}
+
+	return (failures == 0) ? 0 : 1;
+}
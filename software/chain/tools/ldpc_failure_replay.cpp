@@ -0,0 +1,150 @@
+/*
+ * ldpc_failure_replay.cpp
+ *
+ * Replays frames captured by Decoder_Failure_Capture through a decoder
+ * configuration and reports which of them are decoded correctly now. The
+ * decoder is configured from the Decoder_LDPC_IEEE_802_11ad section of a chain
+ * configuration file (first simulation point), single parameters can be
+ * overridden on the command line, e.g., to check whether a different Split Row
+ * threshold fixes the captured failures.
+ *
+ * Usage: ldpc_failure_replay [-threshold <t>] [-num_partitions <p>]
+ *                            [-iterations <n>] [-v] <config> <capture> [<capture> ...]
+ *
+ *   -threshold       Split Row threshold of the decoder
+ *   -num_partitions  Number of Split Row partitions of the decoder
+ *   -iterations      Number of decoder iterations
+ *   -v               Print one line per frame
+ *
+ * Returns 0 if all captured frames are decoded correctly, 1 otherwise.
+ */
+
+#include "../../cse/include/cse_lib.h"
+#include "../ldpc_dec/dec_ldpc_ieee_802_11ad.h"
+#include "../ldpc_dec/dec_failure_capture.h"
+
+#include <iostream>
+#include <cstdlib>
+
+using namespace cse_lib;
+using namespace std;
+
+
+/// Decoder that exposes the code length of its configuration.
+class Decoder_LDPC_Failure_Replay : public Decoder_LDPC_IEEE_802_11ad
+{
+
+public:
+
+	/// Number of channel values of a frame of the configured code.
+	unsigned int Num_Variable_Nodes()
+	{
+		if (param_list_.config_modified())
+			Init();
+		return num_variable_nodes_;
+	}
+};
+
+
+int main(int argc, char *argv[])
+{
+	int threshold      = -1;
+	int num_partitions = -1;
+	int iterations     = -1;
+	bool verbose       = false;
+	int first_file     = argc;
+
+	for (int i = 1; i < argc; i++)
+	{
+		string arg = argv[i];
+
+		if      (arg == "-threshold"      && i + 1 < argc) threshold      = atoi(argv[++i]);
+		else if (arg == "-num_partitions" && i + 1 < argc) num_partitions = atoi(argv[++i]);
+		else if (arg == "-iterations"     && i + 1 < argc) iterations     = atoi(argv[++i]);
+		else if (arg == "-v")                              verbose        = true;
+		else
+		{
+			first_file = i;
+			break;
+		}
+	}
+
+	if (argc - first_file < 2 || argv[first_file][0] == '-')
+	{
+		cerr << "Usage: " << argv[0] << " [-threshold <t>] [-num_partitions <p>]"
+		     << " [-iterations <n>] [-v] <config> <capture> [<capture> ...]" << endl;
+		return 1;
+	}
+
+	unsigned long long num_frames = 0;
+	unsigned long long num_fixed = 0;
+	unsigned long long num_failed = 0;
+
+	try
+	{
+		Manage_Module_Config xml_config(argv[first_file]);
+		Decoder_LDPC_Failure_Replay decoder;
+		Buffer<int> bits_llr;
+		Decoder_Failure_Record record;
+
+		xml_config.Configure_Module(decoder);
+		if (threshold >= 0)
+			decoder.threshold(threshold);
+		if (num_partitions >= 0)
+			decoder.num_partitions(num_partitions);
+		if (iterations >= 0)
+			decoder.num_iterations(iterations);
+
+		decoder.input_bits_llr(bits_llr);
+		bits_llr.Resize(decoder.Num_Variable_Nodes());
+
+		for (int f = first_file + 1; f < argc; f++)
+		{
+			Decoder_Failure_Reader reader;
+			reader.Open(argv[f]);
+
+			while (reader.Read(record))
+			{
+				if (record.bits_llr.length() != bits_llr.length())
+					throw runtime_error("\nException[ldpc_failure_replay]: Frame length of " + string(argv[f]) +
+					                    " does not match the code of the configuration!");
+
+				for (unsigned int i = 0; i < bits_llr.length(); i++)
+					bits_llr[i] = record.bits_llr[i];
+
+				decoder.Run();
+
+				Buffer<u_int, 2> &bits = decoder.output_bits();
+				unsigned int last_row = bits.dim1() - 1;
+				unsigned int num_bits = min(bits.dim2(), record.bits_ref.length());
+				unsigned int num_bit_errors = 0;
+
+				for (unsigned int i = 0; i < num_bits; i++)
+					if (bits[last_row][i] != record.bits_ref[i])
+						num_bit_errors++;
+
+				num_frames++;
+				if (num_bit_errors == 0)
+					num_fixed++;
+				else
+					num_failed++;
+
+				if (verbose)
+					cout << argv[f] << ": point " << record.point << ", frame " << record.frame
+					     << ", noise variance " << record.noise_variance
+					     << ", bit errors " << record.num_bit_errors << " -> " << num_bit_errors
+					     << ", iterations " << decoder.iterations_performed().Read() << endl;
+			}
+		}
+	}
+	catch(exception &e)
+	{
+		cerr << e.what() << endl;
+		return 1;
+	}
+
+	cout << num_frames << " frames, " << num_fixed << " decoded correctly, "
+	     << num_failed << " still failing" << endl;
+
+	return (num_failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+/*
+ * ldpc_trace_replay.cpp
+ *
+ * Replays binary check node traces (decoder parameter trace_file) against the
+ * check node functions of Decoder_LDPC_Binary_HW_Share and checks that the
+ * outputs and parity check results are bit-exact.
+ *
+ * Usage: ldpc_trace_replay <trace> [<trace> ...]
+ * Returns 0 if all records of all traces match, 1 otherwise.
+ */
+
+#include "../../cse/include/cse_lib.h"
+#include "../ldpc_dec/dec_ldpc_bin_hw_share.h"
+
+#include <iostream>
+#include <ctime>
+
+using namespace cse_lib;
+using namespace std;
+
+
+/// Check node functions configured from a trace.
+class Decoder_LDPC_Trace_Replay : public Decoder_LDPC_Binary_HW_Share
+{
+
+public:
+
+	/// Names of the check node algorithms as used in the configuration files.
+	static const char* Algorithm_Name(CHECK_NODE_ENUM algorithm)
+	{
+		switch(algorithm)
+		{
+		case LAMBDA_MIN:                return "LAMBDA_MIN";
+		case MIN_SUM:                   return "MIN_SUM";
+		case MIN_SUM_SELF_CORRECTING:   return "MIN_SUM_SELF_CORRECTING";
+		case SPLIT_ROW:                 return "SPLIT_ROW";
+		case SPLIT_ROW_IMPROVED:        return "SPLIT_ROW_IMPROVED";
+		case SPLIT_ROW_SELF_CORRECTING: return "SPLIT_ROW_SELF_CORRECTING";
+		}
+		return "UNKNOWN";
+	}
+
+	/// Replay a whole trace file, returns the number of mismatching records.
+	unsigned long long Replay(const string &file_name)
+	{
+		unsigned long long num_records = 0;
+		unsigned long long mismatches = 0;
+		unsigned int num_read;
+
+		Open_Trace_Replay(file_name);
+
+		clock_t start = clock();
+		do
+		{
+			num_read = Replay_Trace(num_check_nodes_, mismatches);
+			num_records += num_read;
+		} while (num_read > 0);
+		double seconds = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+		Close_Trace();
+
+		cout << file_name << ": " << Algorithm_Name(check_node_algorithm_)
+		     << ", " << num_records << " check nodes, "
+		     << mismatches << " mismatches, ";
+		if (seconds > 0)
+			cout << num_records / seconds << " check nodes/s" << endl;
+		else
+			cout << "n/a check nodes/s" << endl;
+
+		return mismatches;
+	}
+};
+
+
+int main(int argc, char *argv[])
+{
+	unsigned long long mismatches = 0;
+
+	if (argc < 2)
+	{
+		cerr << "Usage: " << argv[0] << " <trace> [<trace> ...]" << endl;
+		return 1;
+	}
+
+	try
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			Decoder_LDPC_Trace_Replay replay;
+			mismatches += replay.Replay(argv[i]);
+		}
+	}
+	catch(exception &e)
+	{
+		cerr << e.what() << endl;
+		return 1;
+	}
+
+	return (mismatches == 0) ? 0 : 1;
+}
@@ -0,0 +1,210 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Namespace contains functions for bits packed into 64 bit words
+/// \date   2026/10/19
+//
+
+#ifndef BIT_PACKING_H_
+#define BIT_PACKING_H_
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+/// Bits packed into 64 bit words
+/**
+ * Bit i of a sequence is stored in word i / 64 at position i % 64, i.e., the
+ * first bit is the LSB of the first word. Bits beyond the end of the sequence
+ * are zero after Pack_Bits(), the counting functions ignore them anyway.
+ *
+ * Count_Diff_Bits() uses the AVX2 nibble lookup (vpshufb) popcount if the
+ * -mavx2 flag is set, otherwise XOR and a 64 bit popcount per word.
+ */
+namespace bit_packing {
+
+typedef unsigned long long word_t;
+
+/// Number of bits per word
+static const unsigned int WORD_BITS = 64;
+
+/// Number of words to store num_bits bits
+inline unsigned int Num_Words(unsigned int num_bits)
+{
+	return (num_bits + WORD_BITS - 1) / WORD_BITS;
+}
+
+/// Mask of the valid bits of the last word of a sequence of num_bits bits
+inline word_t Last_Word_Mask(unsigned int num_bits)
+{
+	unsigned int rest = num_bits % WORD_BITS;
+	return (rest == 0) ? ~0ULL : (1ULL << rest) - 1;
+}
+
+/// Mask of the lowest n bits of a word (n <= 64)
+inline word_t Low_Mask(unsigned int n)
+{
+	return (n >= WORD_BITS) ? ~0ULL : (1ULL << n) - 1;
+}
+
+/// Get n <= 64 bits starting at bit pos, bit pos is the LSB of the result
+inline word_t Get_Bits(const word_t *words, unsigned int pos, unsigned int n)
+{
+	unsigned int w = pos / WORD_BITS;
+	unsigned int offset = pos % WORD_BITS;
+	word_t x = words[w] >> offset;
+
+	if (offset + n > WORD_BITS)
+		x |= words[w + 1] << (WORD_BITS - offset);
+
+	return x & Low_Mask(n);
+}
+
+/// Set n <= 64 bits starting at bit pos to the lowest n bits of value
+inline void Set_Bits(word_t *words, unsigned int pos, unsigned int n, word_t value)
+{
+	unsigned int w = pos / WORD_BITS;
+	unsigned int offset = pos % WORD_BITS;
+	word_t mask = Low_Mask(n);
+
+	value &= mask;
+	words[w] = (words[w] & ~(mask << offset)) | (value << offset);
+
+	if (offset + n > WORD_BITS)
+		words[w + 1] = (words[w + 1] & ~(mask >> (WORD_BITS - offset))) | (value >> (WORD_BITS - offset));
+}
+
+/// Cyclic right shift of the lowest z <= 64 bits of x by r, bit k of the result is bit (k + r) % z of x
+inline word_t Rotate_Right(word_t x, unsigned int r, unsigned int z)
+{
+	r %= z;
+	if (r == 0)
+		return x;
+	return ((x >> r) | (x << (z - r))) & Low_Mask(z);
+}
+
+/// Number of ones of a word
+inline unsigned int Popcount(word_t x)
+{
+#ifdef __GNUC__
+	return __builtin_popcountll(x);
+#else
+	x = x - ((x >> 1) & 0x5555555555555555ULL);
+	x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+	x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return static_cast<unsigned int>((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/// Position of the lowest one of a word, x must not be zero
+inline unsigned int Count_Trailing_Zeros(word_t x)
+{
+#ifdef __GNUC__
+	return __builtin_ctzll(x);
+#else
+	unsigned int n = 0;
+	while ((x & 1) == 0)
+	{
+		x >>= 1;
+		n++;
+	}
+	return n;
+#endif
+}
+
+/// Pack num_bits values (zero or not zero) into Num_Words(num_bits) words
+template<typename T> void Pack_Bits(const T *bits, unsigned int num_bits, word_t *words)
+{
+	unsigned int num_full = num_bits / WORD_BITS;
+
+	for (unsigned int w = 0; w < num_full; w++)
+	{
+		word_t word = 0;
+		for (unsigned int k = 0; k < WORD_BITS; k++)
+			word |= static_cast<word_t>(bits[w * WORD_BITS + k] != 0) << k;
+		words[w] = word;
+	}
+
+	if (num_bits % WORD_BITS != 0)
+	{
+		word_t word = 0;
+		for (unsigned int k = 0; k < num_bits % WORD_BITS; k++)
+			word |= static_cast<word_t>(bits[num_full * WORD_BITS + k] != 0) << k;
+		words[num_full] = word;
+	}
+}
+
+/// Unpack num_bits bits into values 0 and 1
+template<typename T> void Unpack_Bits(const word_t *words, unsigned int num_bits, T *bits)
+{
+	for (unsigned int i = 0; i < num_bits; i++)
+		bits[i] = static_cast<T>((words[i / WORD_BITS] >> (i % WORD_BITS)) & 1);
+}
+
+/// Number of ones among the first num_bits bits
+inline unsigned int Count_Ones(const word_t *words, unsigned int num_bits)
+{
+	unsigned int num_full = num_bits / WORD_BITS;
+	unsigned int count = 0;
+
+	for (unsigned int w = 0; w < num_full; w++)
+		count += Popcount(words[w]);
+
+	if (num_bits % WORD_BITS != 0)
+		count += Popcount(words[num_full] & Last_Word_Mask(num_bits));
+
+	return count;
+}
+
+#ifdef __AVX2__
+/// Number of ones of a ^ b of num_words words, four words per step (AVX2)
+inline unsigned int Count_Diff_Words_AVX2(const word_t *a, const word_t *b, unsigned int num_words)
+{
+	// Number of ones of each nibble value
+	const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+	                                        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	const __m256i low_mask = _mm256_set1_epi8(0x0F);
+	__m256i sum = _mm256_setzero_si256();
+
+	for (unsigned int w = 0; w < num_words; w += 4)
+	{
+		__m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + w)),
+		                             _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + w)));
+		__m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(x, low_mask));
+		__m256i hi = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(x, 4), low_mask));
+
+		// Horizontal byte sums per 64 bit lane
+		sum = _mm256_add_epi64(sum, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()));
+	}
+
+	return static_cast<unsigned int>(_mm256_extract_epi64(sum, 0) + _mm256_extract_epi64(sum, 1) +
+	                                 _mm256_extract_epi64(sum, 2) + _mm256_extract_epi64(sum, 3));
+}
+#endif
+
+/// Number of differing bits among the first num_bits bits of a and b
+inline unsigned int Count_Diff_Bits(const word_t *a, const word_t *b, unsigned int num_bits)
+{
+	unsigned int num_full = num_bits / WORD_BITS;
+	unsigned int w = 0;
+	unsigned int count = 0;
+
+#ifdef __AVX2__
+	w = num_full & ~3U;
+	count = Count_Diff_Words_AVX2(a, b, w);
+#endif
+
+	for (; w < num_full; w++)
+		count += Popcount(a[w] ^ b[w]);
+
+	if (num_bits % WORD_BITS != 0)
+		count += Popcount((a[num_full] ^ b[num_full]) & Last_Word_Mask(num_bits));
+
+	return count;
+}
+
+} // End namespace bit_packing
+
+#endif // BIT_PACKING_H_
@@ -0,0 +1,389 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Specialization of the buffer class for packed bits
+/// \date   2026/10/19
+//
+
+#ifndef BUFFER_PACKED_H_
+#define BUFFER_PACKED_H_
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "buffer.h"
+#include "bit_packing.h"
+
+
+/// Element type of Buffer<packed_bit>, a buffer of bits packed into 64 bit words
+struct packed_bit { };
+
+
+/// Buffer class for bits, packed into 64 bit words
+/**
+ * Stores binary values with one bit per value instead of one unsigned int,
+ * with the layout of bit_packing: bit i in word i / 64 at position i % 64.
+ * length() is the number of bits, the words are accessed by Word() or
+ * Data_Ptr(). Bits beyond length() in the last word are zero unless the buffer
+ * is a view, all functions of the class ignore them.
+ *
+ * Conversion from and to Buffer<unsigned int> is done by Pack() and Unpack()
+ * (or operator=), nonzero values are packed as ones. Popcount() and
+ * Count_Diff() count ones and differences with bit_packing, operator^= adds
+ * two buffers in GF(2).
+ *
+ * Views work like the views of Buffer<T,1>, but have to start at a multiple of
+ * 64 bits, i.e., at a word boundary.
+ *
+ * \ingroup base_class
+ * \ingroup assistance
+ */
+template <> class Buffer<packed_bit, 1> : public Buffer_Abstract
+{
+
+public:
+
+	typedef bit_packing::word_t word_t;
+
+	/// Create a new buffer with zero bits
+	Buffer() { Init_Members(); }
+
+	/// Create a new buffer of num_bits bits, all zero
+	explicit Buffer(unsigned int num_bits)
+	{
+		Init_Members();
+		Resize(num_bits);
+	}
+
+	/// Copy constructor
+	Buffer(const Buffer<packed_bit, 1>& buffer)
+	{
+		Init_Members();
+		*this = buffer;
+	}
+
+	/// Create a packed copy of the given bits
+	explicit Buffer(const Buffer<unsigned int, 1>& bits)
+	{
+		Init_Members();
+		Pack(bits);
+	}
+
+	/// Creates a partial view or a copy of the given buffer
+	/**
+	 * \param buffer      Source buffer
+	 * \param start_pos   First bit, a multiple of 64 for a view
+	 * \param length      Number of bits, 0: up to the end of the source buffer
+	 * \param buffer_type VIEW_ON_BUFFER or COPY_BUFFER
+	 */
+	Buffer(const Buffer<packed_bit, 1>& buffer, unsigned int start_pos, unsigned int length,
+	       Buffer_Abstract::BUFFER_TYPE_ENUM buffer_type)
+	{
+		Init_Members();
+
+		if (buffer_type == VIEW_ON_BUFFER)
+			Transform_To_View(buffer, start_pos, length);
+		else
+		{
+			if (length == 0)
+				length = buffer.length() - start_pos;
+			Resize(length);
+			for (unsigned int i = 0; i < length; i++)
+				Set(i, buffer[start_pos + i]);
+		}
+	}
+
+	virtual ~Buffer()
+	{
+		if (view_ == false)
+			delete[] mem_ptr_;
+		else if (view_parameter_.parent != 0)
+			view_parameter_.parent->Unregister_As_View(this);
+
+		// Mark all view children as invalid with a size of zero.
+		for (View_List_Iterator iter = view_list_.begin(); iter != view_list_.end(); iter++)
+		{
+			(static_cast<Buffer<packed_bit, 1>* >(*iter))->view_parameter_.parent = 0;
+			(static_cast<Buffer<packed_bit, 1>* >(*iter))->length_ = 0;
+		}
+	}
+
+	/// Resize the buffer to num_bits bits
+	/**
+	 * \param num_bits New number of bits
+	 * \param copy     Keep the values of the first bits if true, otherwise all bits are zero
+	 */
+	void Resize(unsigned int num_bits, bool copy = false)
+	{
+		if (view_)
+		{
+			std::cerr << "\nError [Buffer<packed_bit>]: instance " << instance_name_
+			          << " cannot be resized, because it's only a reference object to a buffer!\n"
+			          << std::endl;
+			throw std::logic_error("\nException[Buffer<packed_bit>]: a view cannot be resized!");
+		}
+
+		if (num_bits == length_)
+			return;
+
+		unsigned int num_words = bit_packing::Num_Words(num_bits);
+		word_t *temp_ptr = new word_t[num_words];
+
+		for (unsigned int w = 0; w < num_words; w++)
+			temp_ptr[w] = 0;
+
+		if (copy)
+		{
+			unsigned int num_copy = std::min(length_, num_bits);
+			for (unsigned int w = 0; w < bit_packing::Num_Words(num_copy); w++)
+				temp_ptr[w] = mem_ptr_[w];
+			if (num_copy > 0)
+				temp_ptr[bit_packing::Num_Words(num_copy) - 1] &= bit_packing::Last_Word_Mask(num_copy);
+		}
+
+		delete[] mem_ptr_;
+		mem_ptr_ = temp_ptr;
+		length_ = num_bits;
+
+#ifndef DISABLE_EVENT_SUPPORT_FLAG
+		Modify_Event();
+#endif
+		Trigger_Views();
+	}
+
+	/// Transform the current buffer instance to a (partial) view of another buffer.
+	/**
+	 * \param src_buffer Buffer to create the view on.
+	 * \param start_pos  First bit of the view, a multiple of 64.
+	 * \param length     Number of bits, 0: up to the end of the source buffer
+	 */
+	void Transform_To_View(const Buffer<packed_bit, 1>& src_buffer, unsigned int start_pos = 0,
+	                       unsigned int length = 0)
+	{
+		if (start_pos % bit_packing::WORD_BITS != 0)
+		{
+			std::cerr << "\nError [Buffer<packed_bit>]: instance " << instance_name_
+			          << ": A view has to start at a multiple of "
+			          << bit_packing::WORD_BITS << " bits!\n" << std::endl;
+			throw std::invalid_argument("\nException[Buffer<packed_bit>]: view is not word aligned!");
+		}
+
+		view_parameter_.length_ = length;
+		view_parameter_.start_pos_ = start_pos;
+
+		if (length == 0)
+			length = src_buffer.length() - start_pos;
+
+		if (start_pos + length > src_buffer.length())
+		{
+			std::cerr << "\nError [Buffer<packed_bit>]: instance " << instance_name_
+			          << ": The size of the buffer view (" << length << ") "
+			          "cannot be larger than the size of the referenced sub buffer ("
+			          << src_buffer.length() - start_pos << ")!\n" << std::endl;
+			throw std::out_of_range("\nException[Buffer<packed_bit>]: view exceeds the buffer!");
+		}
+
+		// Register at the new parent, free own memory when becoming a view
+		if (view_parameter_.parent != &src_buffer)
+		{
+			if (view_ && view_parameter_.parent != 0)
+				view_parameter_.parent->Unregister_As_View(this);
+			src_buffer.Register_As_View(this);
+		}
+		if (view_ == false)
+		{
+			delete[] mem_ptr_;
+			mem_ptr_ = 0;
+		}
+
+		view_ = true;
+		view_parameter_.parent = const_cast<Buffer<packed_bit, 1>*>(&src_buffer);
+
+		word_t *mem_ptr = const_cast<word_t*>(src_buffer.Data_Ptr()) + start_pos / bit_packing::WORD_BITS;
+
+		if (mem_ptr_ != mem_ptr || length_ != length)
+		{
+			mem_ptr_ = mem_ptr;
+			length_ = length;
+#ifndef DISABLE_EVENT_SUPPORT_FLAG
+			Modify_Event();
+#endif
+			Trigger_Views();
+		}
+	}
+
+	/// Copy the bits from buffer to buffer, a view keeps its length
+	Buffer<packed_bit, 1>& operator=(const Buffer<packed_bit, 1>& input)
+	{
+		if (this == &input)
+			return *this;
+
+		if (!view_)
+			Resize(input.length());
+
+		unsigned int num_bits = std::min(length_, input.length());
+		unsigned int num_full = num_bits / bit_packing::WORD_BITS;
+
+		for (unsigned int w = 0; w < num_full; w++)
+			mem_ptr_[w] = input.mem_ptr_[w];
+		for (unsigned int i = num_full * bit_packing::WORD_BITS; i < num_bits; i++)
+			Set(i, input[i]);
+
+		return *this;
+	}
+
+	/// Pack the given bits, same as Pack()
+	Buffer<packed_bit, 1>& operator=(const Buffer<unsigned int, 1>& bits)
+	{
+		Pack(bits);
+		return *this;
+	}
+
+	/// Pack the given bits into the buffer, nonzero values become ones
+	/**
+	 * The buffer is resized to the length of bits, a view has to have this
+	 * length already.
+	 */
+	void Pack(const Buffer<unsigned int, 1>& bits)
+	{
+		if (!view_)
+			Resize(bits.length());
+		else if (length_ != bits.length())
+			throw std::invalid_argument("\nException[Buffer<packed_bit>]: view and bits differ in length!");
+
+		if (length_ == 0)
+			return;
+
+		// A view must not change the bits of its parent behind its end.
+		word_t last = mem_ptr_[Num_Words() - 1] & ~bit_packing::Last_Word_Mask(length_);
+
+		bit_packing::Pack_Bits(bits.Data_Ptr(), length_, mem_ptr_);
+		mem_ptr_[Num_Words() - 1] |= last;
+	}
+
+	/// Unpack the bits into values 0 and 1, bits is resized to length()
+	void Unpack(Buffer<unsigned int, 1>& bits) const
+	{
+		bits.Resize(length_);
+		if (length_ > 0)
+			bit_packing::Unpack_Bits(mem_ptr_, length_, bits.Data_Ptr());
+	}
+
+	/// Get bit i (0 or 1)
+	unsigned int operator[](unsigned int i) const
+	{
+		return static_cast<unsigned int>((mem_ptr_[i / bit_packing::WORD_BITS] >> (i % bit_packing::WORD_BITS)) & 1);
+	}
+
+	/// Set bit i to value (nonzero: 1)
+	void Set(unsigned int i, unsigned int value)
+	{
+		word_t mask = 1ULL << (i % bit_packing::WORD_BITS);
+
+		if (value != 0)
+			mem_ptr_[i / bit_packing::WORD_BITS] |= mask;
+		else
+			mem_ptr_[i / bit_packing::WORD_BITS] &= ~mask;
+	}
+
+	/// Set all bits to zero
+	void Clear()
+	{
+		unsigned int num_full = length_ / bit_packing::WORD_BITS;
+
+		for (unsigned int w = 0; w < num_full; w++)
+			mem_ptr_[w] = 0;
+		if (length_ % bit_packing::WORD_BITS != 0)
+			mem_ptr_[num_full] &= ~bit_packing::Last_Word_Mask(length_);
+	}
+
+	/// Get or set word w, i.e., the bits 64 w to 64 w + 63
+	word_t& Word(unsigned int w) { return mem_ptr_[w]; }
+
+	/// Get word w
+	const word_t& Word(unsigned int w) const { return mem_ptr_[w]; }
+
+	/// Get the pointer of the words, only for advanced users
+	word_t* Data_Ptr() { return mem_ptr_; }
+
+	/// Get the pointer of the words, only for advanced users
+	const word_t* Data_Ptr() const { return mem_ptr_; }
+
+	/// Number of bits
+	unsigned int length() const { return length_; }
+
+	/// Number of words
+	unsigned int Num_Words() const { return bit_packing::Num_Words(length_); }
+
+	/// Number of ones
+	unsigned int Popcount() const
+	{
+		return bit_packing::Count_Ones(mem_ptr_, length_);
+	}
+
+	/// Number of differing bits, the shorter length is taken as reference
+	unsigned int Count_Diff(const Buffer<packed_bit, 1>& buffer) const
+	{
+		return bit_packing::Count_Diff_Bits(mem_ptr_, buffer.mem_ptr_, std::min(length_, buffer.length_));
+	}
+
+	/// Add the given bits in GF(2), the shorter length is taken as reference
+	Buffer<packed_bit, 1>& operator^=(const Buffer<packed_bit, 1>& buffer)
+	{
+		unsigned int num_bits = std::min(length_, buffer.length_);
+		unsigned int num_full = num_bits / bit_packing::WORD_BITS;
+
+		for (unsigned int w = 0; w < num_full; w++)
+			mem_ptr_[w] ^= buffer.mem_ptr_[w];
+		if (num_bits % bit_packing::WORD_BITS != 0)
+			mem_ptr_[num_full] ^= buffer.mem_ptr_[num_full] & bit_packing::Last_Word_Mask(num_bits);
+
+		return *this;
+	}
+
+	/// Print the bits like Buffer<unsigned int>
+	inline friend std::ostream& operator<<(std::ostream& os, const Buffer<packed_bit, 1>& data)
+	{
+		for (unsigned int i = 0; i < data.length_; i++)
+			os << data[i] << ((i + 1 < data.length_) ? ", " : "");
+		return os;
+	}
+
+private:
+
+	void Init_Members()
+	{
+		length_ = 0;
+		mem_ptr_ = 0;
+		view_ = false;
+		view_parameter_.length_ = 0;
+		view_parameter_.start_pos_ = 0;
+		view_parameter_.parent = 0;
+	}
+
+	void View_Parent_Changed()
+	{
+		Transform_To_View(*view_parameter_.parent, view_parameter_.start_pos_, view_parameter_.length_);
+	}
+
+	/// Number of bits
+	unsigned int length_;
+
+	/// Pointer to the words
+	word_t *mem_ptr_;
+
+	/// Buffer View of buffer
+	bool view_;
+
+	/// Original view parameter
+	struct View_Parameter
+	{
+		unsigned int length_;               ///< length of the view, 0: up to the end
+		unsigned int start_pos_;            ///< start position of the view
+		Buffer<packed_bit, 1>* parent;      ///< Pointer to the original buffer object
+	} view_parameter_;
+};
+
+#endif // BUFFER_PACKED_H_
@@ -0,0 +1,499 @@
+#ifndef COUNTER_RANDOM_GENERATOR_H
+#define COUNTER_RANDOM_GENERATOR_H
+
+#include <math.h>
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+/// Counter-based random generator with independent substreams
+/** Counter_Random_Generator
+ * generates equally or normally distributed numbers like
+ * Gaussian_Random_Generator, but keeps its whole state in the instance. The
+ * core is the Philox4x32-10 block function (Salmon et al., "Parallel random
+ * numbers: as easy as 1, 2, 3", SC 2011), which maps a 128 bit counter and a
+ * 64 bit key to 128 random bits.
+ *
+ * The key is the seed, the counter is made of the stream and the position
+ * within the stream. Any (seed, stream) pair, e.g., (start_seed, frame index),
+ * selects an independent and reproducible substream that does not depend on
+ * the order in which frames are processed. Instances do not share any data, so
+ * each thread can use its own instance without locking.
+ *
+ * get_random(float*, unsigned int) fills a whole frame with single precision
+ * Gaussian numbers. It runs the Philox rounds and the Box-Muller transform on
+ * several blocks at once, with AVX2 if the -mavx2 flag is set, otherwise with
+ * SSE2 if the -msse2 flag is set. The scalar and the vector code use the same
+ * polynomial approximations of log, sin and cos, so the results do not depend
+ * on the instruction set (up to the rounding of fused multiply-adds).
+ */
+class Counter_Random_Generator
+{
+	public:
+		/// Initializes with seed 0, stream 0
+		Counter_Random_Generator() { reset(0U); }
+		/// Initializes with a given seed, stream 0
+		Counter_Random_Generator(unsigned int seed) { reset(seed); }
+		/// Initializes with a given seed and stream
+		Counter_Random_Generator(unsigned int seed, unsigned long long stream) { reset(seed); set_stream(stream); }
+
+		/// resets the random numbers with the last seed, stream 0
+		void reset() { reset(last_seed); }
+		/// resets the random numbers with a given seed, stream 0
+		void reset(unsigned int seed) { last_seed = seed; key[0] = seed; key[1] = 0; set_stream(0); }
+
+		/// restarts the random numbers at the beginning of the given stream
+		void set_stream(unsigned long long stream) {
+			curr_stream = stream;
+			position = 0;
+			left = 0;
+		}
+		/// current stream
+		unsigned long long stream() const { return curr_stream; }
+
+		unsigned int random_int() {
+			if (left == 0) reload();
+			return block[4 - left--];
+		}
+
+		/**random_01
+		 * returns a equally distributed random number in range of (0,1)
+		 */
+		double random_01() { return (random_int() + 0.5) * (1.0 / 4294967296.0); }
+		/**random_01_lclosed
+		 * returns a equally distributed random number in range of [0,1)
+		 */
+		double random_01_lclosed() { return random_int() * (1.0 / 4294967296.0); }
+
+		/**get_random
+		 * param: double output[2]
+		 * generates two normally distributed random numbers (Box-Muller) and
+		 * stores them in output.
+		 */
+		void get_random(double output[2]) {
+			double radius = sqrt(-2.0 * log(random_01()));
+			double angle  = 6.283185307179586 * random_01();
+			output[0] = radius * cos(angle);
+			output[1] = radius * sin(angle);
+		}
+
+		/**get_random
+		 * param: float output[], unsigned int length
+		 * fills output with length normally distributed random numbers in
+		 * single precision. The numbers are taken from the stream in blocks of
+		 * four, starting at the next block: the numbers of a partly used block
+		 * are skipped, as are the unused numbers of the last block. Numbers
+		 * beyond 6.6 standard deviations are not generated.
+		 */
+		void get_random(float *output, unsigned int length) {
+			unsigned int i = 0;
+
+			left = 0;
+#ifdef __AVX2__
+			for (; i + 32 <= length; i += 32, position += 8)
+				Box_Muller_AVX2(position, output + i);
+#endif
+#ifdef __SSE2__
+			for (; i + 16 <= length; i += 16, position += 4)
+				Box_Muller_SSE2(position, output + i);
+#endif
+			for (; i + 4 <= length; i += 4, position++)
+				Box_Muller_Block(position, output + i);
+
+			if (i < length) {
+				float last[4];
+				Box_Muller_Block(position++, last);
+				memcpy(output + i, last, (length - i) * sizeof(float));
+			}
+		}
+
+		/**Philox4x32
+		 * param: const unsigned int counter[4], const unsigned int key[2], unsigned int output[4]
+		 * the Philox4x32-10 block function
+		 */
+		static void Philox4x32(const unsigned int counter[4], const unsigned int key[2], unsigned int output[4]) {
+			unsigned int c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+			unsigned int k0 = key[0], k1 = key[1];
+
+			for (int round = 0; round < 10; round++) {
+				unsigned long long p0 = static_cast<unsigned long long>(0xD2511F53U) * c0;
+				unsigned long long p1 = static_cast<unsigned long long>(0xCD9E8D57U) * c2;
+				unsigned int hi0 = static_cast<unsigned int>(p0 >> 32), lo0 = static_cast<unsigned int>(p0);
+				unsigned int hi1 = static_cast<unsigned int>(p1 >> 32), lo1 = static_cast<unsigned int>(p1);
+
+				c0 = hi1 ^ c1 ^ k0;
+				c1 = lo1;
+				c2 = hi0 ^ c3 ^ k1;
+				c3 = lo0;
+
+				k0 += 0x9E3779B9U;
+				k1 += 0xBB67AE85U;
+			}
+
+			output[0] = c0;
+			output[1] = c1;
+			output[2] = c2;
+			output[3] = c3;
+		}
+
+	private:
+		unsigned int last_seed;
+		unsigned int key[2];
+		unsigned long long curr_stream;
+		unsigned long long position;
+		unsigned int block[4];
+		int left;
+
+		/// computes the next four random numbers of the stream
+		void reload() {
+			Philox_Block(position, block);
+			position++;
+			left = 4;
+		}
+
+		/// computes the four random numbers of a block of the stream
+		void Philox_Block(unsigned long long pos, unsigned int output[4]) const {
+			unsigned int counter[4] = {
+				static_cast<unsigned int>(pos), static_cast<unsigned int>(pos >> 32),
+				static_cast<unsigned int>(curr_stream), static_cast<unsigned int>(curr_stream >> 32) };
+			Philox4x32(counter, key, output);
+		}
+
+
+		/*
+		 * Single precision Box-Muller transform of a block (u0, u1, u2, u3):
+		 * (r01 cos t01, r01 sin t01, r23 cos t23, r23 sin t23) with the radius
+		 * r = sqrt(-2 ln u) of u0 (u2) and the angle t = 2 pi u of u1 (u3).
+		 * The radius uses 31 bits, (u >> 1) + 0.5 is in (0, 2^31), the angle
+		 * uses 24 bits. log is the Cephes logf polynomial, sin and cos are the
+		 * Cephes polynomials on [-pi/4, pi/4] after a reduction to quadrants.
+		 */
+
+		static float Radius(unsigned int u) {
+			float x = (static_cast<float>(static_cast<int>(u >> 1)) + 0.5f) * 4.656612873077393e-10f;
+			unsigned int bits;
+			memcpy(&bits, &x, sizeof(bits));
+
+			int e = static_cast<int>(bits >> 23) - 126;
+			bits = (bits & 0x807FFFFFU) | 0x3F000000U;
+			float m;
+			memcpy(&m, &bits, sizeof(m));
+
+			if (m < 0.707106781186547524f) {
+				e -= 1;
+				m = m + m - 1.0f;
+			} else {
+				m = m - 1.0f;
+			}
+
+			float z = m * m;
+			float y = 7.0376836292E-2f;
+			y = y * m - 1.1514610310E-1f;
+			y = y * m + 1.1676998740E-1f;
+			y = y * m - 1.2420140846E-1f;
+			y = y * m + 1.4249322787E-1f;
+			y = y * m - 1.6668057665E-1f;
+			y = y * m + 2.0000714765E-1f;
+			y = y * m - 2.4999993993E-1f;
+			y = y * m + 3.3333331174E-1f;
+			y = y * m * z;
+
+			float fe = static_cast<float>(e);
+			y = y + fe * -2.12194440e-4f;
+			y = y - 0.5f * z;
+			float ln = m + y;
+			ln = ln + fe * 0.693359375f;
+
+			float r2 = -2.0f * ln;
+			return sqrtf(r2 > 0.0f ? r2 : 0.0f);
+		}
+
+		static void Sin_Cos(unsigned int u, float &sin_out, float &cos_out) {
+			float s = static_cast<float>(static_cast<int>(u >> 8)) * 2.384185791015625e-7f;
+			int k = static_cast<int>(s + 0.5f);
+			float phi = (s - static_cast<float>(k)) * 1.5707963267948966f;
+			float z = phi * phi;
+
+			float sp = -1.9515295891E-4f;
+			sp = sp * z + 8.3321608736E-3f;
+			sp = sp * z - 1.6666654611E-1f;
+			sp = sp * z * phi + phi;
+
+			float cp = 2.443315711809948E-5f;
+			cp = cp * z - 1.388731625493765E-3f;
+			cp = cp * z + 4.166664568298827E-2f;
+			cp = cp * z * z - 0.5f * z + 1.0f;
+
+			float sv = (k & 1) ? cp : sp;
+			float cv = (k & 1) ? sp : cp;
+			sin_out = (k & 2) ? -sv : sv;
+			cos_out = ((k + 1) & 2) ? -cv : cv;
+		}
+
+		void Box_Muller_Block(unsigned long long pos, float output[4]) const {
+			unsigned int u[4];
+			float sin01, cos01, sin23, cos23;
+
+			Philox_Block(pos, u);
+			float r01 = Radius(u[0]);
+			float r23 = Radius(u[2]);
+			Sin_Cos(u[1], sin01, cos01);
+			Sin_Cos(u[3], sin23, cos23);
+
+			output[0] = r01 * cos01;
+			output[1] = r01 * sin01;
+			output[2] = r23 * cos23;
+			output[3] = r23 * sin23;
+		}
+
+#ifdef __SSE2__
+		/// low and high 32 bits of the products of a 32 bit constant and four 32 bit values
+		static void Mul_Hi_Lo(__m128i x, __m128i m, __m128i &hi, __m128i &lo) {
+			const __m128i mask_lo = _mm_set_epi32(0, -1, 0, -1);
+			__m128i even = _mm_mul_epu32(x, m);
+			__m128i odd  = _mm_mul_epu32(_mm_srli_epi64(x, 32), m);
+			lo = _mm_or_si128(_mm_and_si128(even, mask_lo), _mm_slli_epi64(odd, 32));
+			hi = _mm_or_si128(_mm_srli_epi64(even, 32), _mm_andnot_si128(mask_lo, odd));
+		}
+
+		static __m128 Radius(__m128i u) {
+			__m128 x = _mm_mul_ps(_mm_add_ps(_mm_cvtepi32_ps(_mm_srli_epi32(u, 1)), _mm_set1_ps(0.5f)),
+			                      _mm_set1_ps(4.656612873077393e-10f));
+			__m128i bits = _mm_castps_si128(x);
+
+			__m128i e = _mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126));
+			__m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x807FFFFF)),
+			                                         _mm_set1_epi32(0x3F000000)));
+
+			__m128 small = _mm_cmplt_ps(m, _mm_set1_ps(0.707106781186547524f));
+			e = _mm_add_epi32(e, _mm_castps_si128(small));
+			m = _mm_sub_ps(_mm_add_ps(m, _mm_and_ps(m, small)), _mm_set1_ps(1.0f));
+
+			__m128 z = _mm_mul_ps(m, m);
+			__m128 y = _mm_set1_ps(7.0376836292E-2f);
+			y = _mm_sub_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.1514610310E-1f));
+			y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.1676998740E-1f));
+			y = _mm_sub_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.2420140846E-1f));
+			y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.4249322787E-1f));
+			y = _mm_sub_ps(_mm_mul_ps(y, m), _mm_set1_ps(1.6668057665E-1f));
+			y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(2.0000714765E-1f));
+			y = _mm_sub_ps(_mm_mul_ps(y, m), _mm_set1_ps(2.4999993993E-1f));
+			y = _mm_add_ps(_mm_mul_ps(y, m), _mm_set1_ps(3.3333331174E-1f));
+			y = _mm_mul_ps(_mm_mul_ps(y, m), z);
+
+			__m128 fe = _mm_cvtepi32_ps(e);
+			y = _mm_add_ps(y, _mm_mul_ps(fe, _mm_set1_ps(-2.12194440e-4f)));
+			y = _mm_sub_ps(y, _mm_mul_ps(_mm_set1_ps(0.5f), z));
+			__m128 ln = _mm_add_ps(m, y);
+			ln = _mm_add_ps(ln, _mm_mul_ps(fe, _mm_set1_ps(0.693359375f)));
+
+			__m128 r2 = _mm_mul_ps(_mm_set1_ps(-2.0f), ln);
+			return _mm_sqrt_ps(_mm_max_ps(r2, _mm_setzero_ps()));
+		}
+
+		static void Sin_Cos(__m128i u, __m128 &sin_out, __m128 &cos_out) {
+			__m128 s = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(u, 8)), _mm_set1_ps(2.384185791015625e-7f));
+			__m128i k = _mm_cvttps_epi32(_mm_add_ps(s, _mm_set1_ps(0.5f)));
+			__m128 phi = _mm_mul_ps(_mm_sub_ps(s, _mm_cvtepi32_ps(k)), _mm_set1_ps(1.5707963267948966f));
+			__m128 z = _mm_mul_ps(phi, phi);
+
+			__m128 sp = _mm_set1_ps(-1.9515295891E-4f);
+			sp = _mm_add_ps(_mm_mul_ps(sp, z), _mm_set1_ps(8.3321608736E-3f));
+			sp = _mm_sub_ps(_mm_mul_ps(sp, z), _mm_set1_ps(1.6666654611E-1f));
+			sp = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(sp, z), phi), phi);
+
+			__m128 cp = _mm_set1_ps(2.443315711809948E-5f);
+			cp = _mm_sub_ps(_mm_mul_ps(cp, z), _mm_set1_ps(1.388731625493765E-3f));
+			cp = _mm_add_ps(_mm_mul_ps(cp, z), _mm_set1_ps(4.166664568298827E-2f));
+			cp = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(cp, z), z), _mm_mul_ps(_mm_set1_ps(0.5f), z)),
+			                _mm_set1_ps(1.0f));
+
+			__m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(k, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+			__m128 sv = _mm_or_ps(_mm_and_ps(swap, cp), _mm_andnot_ps(swap, sp));
+			__m128 cv = _mm_or_ps(_mm_and_ps(swap, sp), _mm_andnot_ps(swap, cp));
+			__m128i sin_sign = _mm_slli_epi32(_mm_and_si128(k, _mm_set1_epi32(2)), 30);
+			__m128i cos_sign = _mm_slli_epi32(_mm_and_si128(_mm_add_epi32(k, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30);
+			sin_out = _mm_xor_ps(sv, _mm_castsi128_ps(sin_sign));
+			cos_out = _mm_xor_ps(cv, _mm_castsi128_ps(cos_sign));
+		}
+
+		/// Box-Muller transform of the four blocks starting at pos
+		void Box_Muller_SSE2(unsigned long long pos, float output[16]) const {
+			unsigned long long p1 = pos + 1, p2 = pos + 2, p3 = pos + 3;
+			__m128i c0 = _mm_setr_epi32(static_cast<int>(pos), static_cast<int>(p1),
+			                            static_cast<int>(p2), static_cast<int>(p3));
+			__m128i c1 = _mm_setr_epi32(static_cast<int>(pos >> 32), static_cast<int>(p1 >> 32),
+			                            static_cast<int>(p2 >> 32), static_cast<int>(p3 >> 32));
+			__m128i c2 = _mm_set1_epi32(static_cast<int>(curr_stream));
+			__m128i c3 = _mm_set1_epi32(static_cast<int>(curr_stream >> 32));
+			__m128i k0 = _mm_set1_epi32(static_cast<int>(key[0]));
+			__m128i k1 = _mm_set1_epi32(static_cast<int>(key[1]));
+			const __m128i m0 = _mm_set1_epi32(static_cast<int>(0xD2511F53U));
+			const __m128i m1 = _mm_set1_epi32(static_cast<int>(0xCD9E8D57U));
+			__m128i hi0, lo0, hi1, lo1;
+
+			for (int round = 0; round < 10; round++) {
+				Mul_Hi_Lo(c0, m0, hi0, lo0);
+				Mul_Hi_Lo(c2, m1, hi1, lo1);
+				c0 = _mm_xor_si128(_mm_xor_si128(hi1, c1), k0);
+				c1 = lo1;
+				c2 = _mm_xor_si128(_mm_xor_si128(hi0, c3), k1);
+				c3 = lo0;
+				k0 = _mm_add_epi32(k0, _mm_set1_epi32(static_cast<int>(0x9E3779B9U)));
+				k1 = _mm_add_epi32(k1, _mm_set1_epi32(static_cast<int>(0xBB67AE85U)));
+			}
+
+			__m128 sin01, cos01, sin23, cos23;
+			__m128 r01 = Radius(c0);
+			__m128 r23 = Radius(c2);
+			Sin_Cos(c1, sin01, cos01);
+			Sin_Cos(c3, sin23, cos23);
+			cos01 = _mm_mul_ps(r01, cos01);
+			sin01 = _mm_mul_ps(r01, sin01);
+			cos23 = _mm_mul_ps(r23, cos23);
+			sin23 = _mm_mul_ps(r23, sin23);
+
+			// Lane j holds block j, transpose to the order of the stream.
+			__m128 t0 = _mm_unpacklo_ps(cos01, sin01);
+			__m128 t1 = _mm_unpackhi_ps(cos01, sin01);
+			__m128 t2 = _mm_unpacklo_ps(cos23, sin23);
+			__m128 t3 = _mm_unpackhi_ps(cos23, sin23);
+			_mm_storeu_ps(output,      _mm_movelh_ps(t0, t2));
+			_mm_storeu_ps(output + 4,  _mm_movehl_ps(t2, t0));
+			_mm_storeu_ps(output + 8,  _mm_movelh_ps(t1, t3));
+			_mm_storeu_ps(output + 12, _mm_movehl_ps(t3, t1));
+		}
+#endif
+
+#ifdef __AVX2__
+		/// low and high 32 bits of the products of a 32 bit constant and eight 32 bit values
+		static void Mul_Hi_Lo(__m256i x, __m256i m, __m256i &hi, __m256i &lo) {
+			const __m256i mask_lo = _mm256_set_epi32(0, -1, 0, -1, 0, -1, 0, -1);
+			__m256i even = _mm256_mul_epu32(x, m);
+			__m256i odd  = _mm256_mul_epu32(_mm256_srli_epi64(x, 32), m);
+			lo = _mm256_or_si256(_mm256_and_si256(even, mask_lo), _mm256_slli_epi64(odd, 32));
+			hi = _mm256_or_si256(_mm256_srli_epi64(even, 32), _mm256_andnot_si256(mask_lo, odd));
+		}
+
+		static __m256 Radius(__m256i u) {
+			__m256 x = _mm256_mul_ps(_mm256_add_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(u, 1)), _mm256_set1_ps(0.5f)),
+			                         _mm256_set1_ps(4.656612873077393e-10f));
+			__m256i bits = _mm256_castps_si256(x);
+
+			__m256i e = _mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126));
+			__m256 m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x807FFFFF)),
+			                                               _mm256_set1_epi32(0x3F000000)));
+
+			__m256 small = _mm256_cmp_ps(m, _mm256_set1_ps(0.707106781186547524f), _CMP_LT_OQ);
+			e = _mm256_add_epi32(e, _mm256_castps_si256(small));
+			m = _mm256_sub_ps(_mm256_add_ps(m, _mm256_and_ps(m, small)), _mm256_set1_ps(1.0f));
+
+			__m256 z = _mm256_mul_ps(m, m);
+			__m256 y = _mm256_set1_ps(7.0376836292E-2f);
+			y = _mm256_sub_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(1.1514610310E-1f));
+			y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(1.1676998740E-1f));
+			y = _mm256_sub_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(1.2420140846E-1f));
+			y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(1.4249322787E-1f));
+			y = _mm256_sub_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(1.6668057665E-1f));
+			y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(2.0000714765E-1f));
+			y = _mm256_sub_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(2.4999993993E-1f));
+			y = _mm256_add_ps(_mm256_mul_ps(y, m), _mm256_set1_ps(3.3333331174E-1f));
+			y = _mm256_mul_ps(_mm256_mul_ps(y, m), z);
+
+			__m256 fe = _mm256_cvtepi32_ps(e);
+			y = _mm256_add_ps(y, _mm256_mul_ps(fe, _mm256_set1_ps(-2.12194440e-4f)));
+			y = _mm256_sub_ps(y, _mm256_mul_ps(_mm256_set1_ps(0.5f), z));
+			__m256 ln = _mm256_add_ps(m, y);
+			ln = _mm256_add_ps(ln, _mm256_mul_ps(fe, _mm256_set1_ps(0.693359375f)));
+
+			__m256 r2 = _mm256_mul_ps(_mm256_set1_ps(-2.0f), ln);
+			return _mm256_sqrt_ps(_mm256_max_ps(r2, _mm256_setzero_ps()));
+		}
+
+		static void Sin_Cos(__m256i u, __m256 &sin_out, __m256 &cos_out) {
+			__m256 s = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(u, 8)), _mm256_set1_ps(2.384185791015625e-7f));
+			__m256i k = _mm256_cvttps_epi32(_mm256_add_ps(s, _mm256_set1_ps(0.5f)));
+			__m256 phi = _mm256_mul_ps(_mm256_sub_ps(s, _mm256_cvtepi32_ps(k)), _mm256_set1_ps(1.5707963267948966f));
+			__m256 z = _mm256_mul_ps(phi, phi);
+
+			__m256 sp = _mm256_set1_ps(-1.9515295891E-4f);
+			sp = _mm256_add_ps(_mm256_mul_ps(sp, z), _mm256_set1_ps(8.3321608736E-3f));
+			sp = _mm256_sub_ps(_mm256_mul_ps(sp, z), _mm256_set1_ps(1.6666654611E-1f));
+			sp = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(sp, z), phi), phi);
+
+			__m256 cp = _mm256_set1_ps(2.443315711809948E-5f);
+			cp = _mm256_sub_ps(_mm256_mul_ps(cp, z), _mm256_set1_ps(1.388731625493765E-3f));
+			cp = _mm256_add_ps(_mm256_mul_ps(cp, z), _mm256_set1_ps(4.166664568298827E-2f));
+			cp = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(_mm256_mul_ps(cp, z), z), _mm256_mul_ps(_mm256_set1_ps(0.5f), z)),
+			                   _mm256_set1_ps(1.0f));
+
+			__m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(k, _mm256_set1_epi32(1)),
+			                                                     _mm256_set1_epi32(1)));
+			__m256 sv = _mm256_blendv_ps(sp, cp, swap);
+			__m256 cv = _mm256_blendv_ps(cp, sp, swap);
+			__m256i sin_sign = _mm256_slli_epi32(_mm256_and_si256(k, _mm256_set1_epi32(2)), 30);
+			__m256i cos_sign = _mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(k, _mm256_set1_epi32(1)),
+			                                                      _mm256_set1_epi32(2)), 30);
+			sin_out = _mm256_xor_ps(sv, _mm256_castsi256_ps(sin_sign));
+			cos_out = _mm256_xor_ps(cv, _mm256_castsi256_ps(cos_sign));
+		}
+
+		/// Box-Muller transform of the eight blocks starting at pos
+		void Box_Muller_AVX2(unsigned long long pos, float output[32]) const {
+			unsigned int lo[8], hi[8];
+			for (int j = 0; j < 8; j++) {
+				lo[j] = static_cast<unsigned int>(pos + j);
+				hi[j] = static_cast<unsigned int>((pos + j) >> 32);
+			}
+			__m256i c0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lo));
+			__m256i c1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hi));
+			__m256i c2 = _mm256_set1_epi32(static_cast<int>(curr_stream));
+			__m256i c3 = _mm256_set1_epi32(static_cast<int>(curr_stream >> 32));
+			__m256i k0 = _mm256_set1_epi32(static_cast<int>(key[0]));
+			__m256i k1 = _mm256_set1_epi32(static_cast<int>(key[1]));
+			const __m256i m0 = _mm256_set1_epi32(static_cast<int>(0xD2511F53U));
+			const __m256i m1 = _mm256_set1_epi32(static_cast<int>(0xCD9E8D57U));
+			__m256i hi0, lo0, hi1, lo1;
+
+			for (int round = 0; round < 10; round++) {
+				Mul_Hi_Lo(c0, m0, hi0, lo0);
+				Mul_Hi_Lo(c2, m1, hi1, lo1);
+				c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1), k0);
+				c1 = lo1;
+				c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3), k1);
+				c3 = lo0;
+				k0 = _mm256_add_epi32(k0, _mm256_set1_epi32(static_cast<int>(0x9E3779B9U)));
+				k1 = _mm256_add_epi32(k1, _mm256_set1_epi32(static_cast<int>(0xBB67AE85U)));
+			}
+
+			__m256 sin01, cos01, sin23, cos23;
+			__m256 r01 = Radius(c0);
+			__m256 r23 = Radius(c2);
+			Sin_Cos(c1, sin01, cos01);
+			Sin_Cos(c3, sin23, cos23);
+			cos01 = _mm256_mul_ps(r01, cos01);
+			sin01 = _mm256_mul_ps(r01, sin01);
+			cos23 = _mm256_mul_ps(r23, cos23);
+			sin23 = _mm256_mul_ps(r23, sin23);
+
+			// Lane j holds block j, transpose to the order of the stream.
+			__m256 t0 = _mm256_unpacklo_ps(cos01, sin01);
+			__m256 t1 = _mm256_unpackhi_ps(cos01, sin01);
+			__m256 t2 = _mm256_unpacklo_ps(cos23, sin23);
+			__m256 t3 = _mm256_unpackhi_ps(cos23, sin23);
+			__m256 b04 = _mm256_shuffle_ps(t0, t2, 0x44);
+			__m256 b15 = _mm256_shuffle_ps(t0, t2, 0xEE);
+			__m256 b26 = _mm256_shuffle_ps(t1, t3, 0x44);
+			__m256 b37 = _mm256_shuffle_ps(t1, t3, 0xEE);
+			_mm256_storeu_ps(output,      _mm256_permute2f128_ps(b04, b15, 0x20));
+			_mm256_storeu_ps(output + 8,  _mm256_permute2f128_ps(b26, b37, 0x20));
+			_mm256_storeu_ps(output + 16, _mm256_permute2f128_ps(b04, b15, 0x31));
+			_mm256_storeu_ps(output + 24, _mm256_permute2f128_ps(b26, b37, 0x31));
+		}
+#endif
+};
+#endif
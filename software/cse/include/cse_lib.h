@@ -31,6 +31,8 @@
 #include "../modules/base/status_out_plugin_mean.h"
 #include "../modules/base/param.h"
 #include "../modules/base/status_out_plugin_hist.h"
+#include "../modules/base/status_out_plugin_mean_sharded.h"
+#include "../modules/base/status_out_plugin_hist_sharded.h"
 #include "../modules/base/base_iface.h"
 #include "../modules/transmit/mapper_param.h"
 #include "../modules/transmit/mapper_share.h"
@@ -56,10 +58,13 @@
 #include "../assistance/unique_id_instance.h"
 #include "../assistance/iter_var_struct.h"
 #include "../assistance/gaussian_random_generator.h"
+#include "../assistance/counter_random_generator.h"
 #include "../assistance/manage_module_config.h"
 #include "../assistance/helper_functions.h"
 #include "../assistance/buffer.h"
 #include "../assistance/buffer_math.h"
+#include "../assistance/bit_packing.h"
+#include "../assistance/buffer_packed.h"
 
 #include "../modules/converter/conv_float_fixp.h"
 #include "../modules/converter/conv_float_fixp_iface.h"
@@ -19,6 +19,8 @@
 #include "status_out_plugins.h"
 #include "status_out_plugin_mean.h"
 #include "status_out_plugin_hist.h"
+#include "status_out_plugin_mean_sharded.h"
+#include "status_out_plugin_hist_sharded.h"
 
 namespace cse_lib {
 
@@ -49,12 +51,11 @@ public:
 		plugin_inst_.Delete_Recursive();
 	}
 
-	/// Reset all plug-in values of the port
+	/// Reset all plug-in values of the port, in all dimensions
 	void Reset()
 	{
 		// Reset all instances
-		for(unsigned int i=0; i < plugin_inst_.dim(); i++)
-			plugin_inst_(i)().Reset();
+		plugin_inst_.Reset_Recursive();
 	}
 
 	/// Return the name of dimension with the index i
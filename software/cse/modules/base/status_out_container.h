@@ -62,6 +62,13 @@ private:
 		children_ = 0;
 	}
 
+	// Reset all plug-in instances recursively
+	void Reset_Recursive()
+	{
+		for(unsigned int i = 0; i < dim_; i++)
+			children_[i].Reset_Recursive();
+	}
+
 	void Extent_Dim(int new_dim)
 	{
 		// Extent own dimension
@@ -189,6 +196,13 @@ private:
 		plug_inst_ = 0;
 	}
 
+	// Reset the plug-in instance, a missing instance is created reseted on access
+	void Reset_Recursive()
+	{
+		if(plug_inst_ != 0)
+			plug_inst_->Reset();
+	}
+
 	/// Pointer to the plug-in instance
 	P* plug_inst_;
 
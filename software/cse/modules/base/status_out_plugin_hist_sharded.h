@@ -0,0 +1,198 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Sharded histogram plug-in with preallocated range for the status out port
+/// \date   2026/10/19
+//
+
+#ifndef STATUS_OUT_PLUGIN_HIST_SHARDED_H_
+#define STATUS_OUT_PLUGIN_HIST_SHARDED_H_
+
+#include "status_out_plugin_abstract.h"
+#include "status_out_plugin_mean_sharded.h"
+
+namespace cse_lib {
+
+/// Histogram plug-in for the Status_Out port with a fixed range and one histogram per writing thread.
+/**
+ * Same output as Status_Out_Plugin_Histogram, but the bins are allocated once
+ * for the range given by range(), so Write() never reallocates memory. Values
+ * outside of the range are counted in the first or last bin. The default
+ * range is 0 ... 1023 with a bin size of 1.
+ *
+ * The histogram is kept in STATUS_OUT_PLUGIN_NUM_SHARDS shards. Each writing
+ * thread uses its own shard, e.g. its worker index, by Write(value, shard).
+ * As every shard has a single writer and the shards are separated by a cache
+ * line, no locks or atomic operations are required. The shards are merged by
+ * Read() and Get_Value_Str(), which must not be called while other threads
+ * are writing.
+ *
+ * \ingroup status_out_plugin
+ */
+template<class T>
+class Status_Out_Plugin_Histogram_Sharded : public Status_Out_Plugin_Abstract
+{
+public:
+
+	Status_Out_Plugin_Histogram_Sharded()
+	{
+		dim_name_ = "bin";
+		range(0, 1023);
+	}
+
+	virtual ~Status_Out_Plugin_Histogram_Sharded() {}
+
+	/// Data type of the output values
+	typedef float OUTPUT_TYPE;
+
+	/// Reset the memory, the range is kept.
+	void Reset()
+	{
+		curr_pos_ = 0;
+		bins_.Clear();
+		merged_.Clear();
+		counter_ = 0;
+	}
+
+	/// Set the range of the histogram and allocate the bins, resets the histogram.
+	/**
+	 * \param min_value Smallest value that gets a bin of its own
+	 * \param max_value Largest value that gets a bin of its own
+	 * \param bin_size  Distance between two bins of the histogram
+	 */
+	void range(T min_value, T max_value, T bin_size = 1)
+	{
+		// Number of bins of one cache line
+		unsigned int line_bins = STATUS_OUT_PLUGIN_CACHE_LINE_SIZE / sizeof(ull_int);
+
+		bin_size_  = bin_size;
+		min_index_ = static_cast<int> (min_value / bin_size_);
+		max_index_ = static_cast<int> (max_value / bin_size_);
+		if (max_index_ < min_index_)
+			max_index_ = min_index_;
+
+		num_bins_ = static_cast<unsigned int> (max_index_ - min_index_ + 1);
+
+		// Whole cache lines for each shard and one cache line distance between two shards.
+		stride_ = ((num_bins_ + line_bins - 1) / line_bins + 1) * line_bins;
+
+		bins_.Resize(STATUS_OUT_PLUGIN_NUM_SHARDS * stride_);
+		merged_.Resize(num_bins_);
+
+		Reset();
+	}
+
+	/// Return the merged histogram value at the position index, normalized to the number of values.
+	OUTPUT_TYPE Read(int index)
+	{
+		Merge();
+
+		if (index < min_index_ || index > max_index_ || counter_ == 0)
+			return 0.0;
+
+		return static_cast<OUTPUT_TYPE> (merged_[index - min_index_]) / counter_;
+	}
+
+	/// Increment the histogram of the first shard at position value.
+	void Write(T value)
+	{
+		bins_[Bin(value)]++;
+	}
+
+	/// Increment the histogram of the shard of the calling thread at position value.
+	/**
+	 * \param value value to count
+	 * \param shard shard of the calling thread, 0 ... STATUS_OUT_PLUGIN_NUM_SHARDS - 1
+	 */
+	void Write(T value, unsigned int shard)
+	{
+		if (shard >= STATUS_OUT_PLUGIN_NUM_SHARDS)
+			shard %= STATUS_OUT_PLUGIN_NUM_SHARDS;
+
+		bins_[shard * stride_ + Bin(value)]++;
+	}
+
+	/// Return the number of histogram points.
+	u_int length()
+	{
+		return num_bins_;
+	}
+
+	/// Gives one datum of the merged histogram and returns true as long as data is available.
+	bool Get_Value_Str(Status_Out_Data_Struct& data)
+	{
+		// Merge the shards once for each readout.
+		if (curr_pos_ == 0)
+			Merge();
+
+		if(curr_pos_ < num_bins_ && counter_ != 0)
+		{
+			int curr_pos_int = static_cast<int>(curr_pos_) + min_index_;
+
+			// Empty data structure before writing.
+			data.Clear();
+			data.value = Conv_Num_To_Str(static_cast<OUTPUT_TYPE> (merged_[curr_pos_]) / counter_);
+			string str_tmp = Conv_Num_To_Str(curr_pos_int);
+			data.address.Append(str_tmp);
+			data.dim_name.Append(dim_name_);
+			curr_pos_++;
+			return true;
+		}
+		else
+		{
+			curr_pos_ = 0;
+			return false;
+		}
+	}
+
+private:
+
+	// Bin of the value within a shard, values out of range go to the outer bins.
+	unsigned int Bin(T value)
+	{
+		int index = static_cast<int> (value / bin_size_);
+
+		if (index < min_index_)
+			index = min_index_;
+		else if (index > max_index_)
+			index = max_index_;
+
+		return static_cast<unsigned int> (index - min_index_);
+	}
+
+	// Sum up the histograms of all shards.
+	void Merge()
+	{
+		counter_ = 0;
+		for (unsigned int b = 0; b < num_bins_; b++)
+		{
+			ull_int sum = 0;
+			for (unsigned int s = 0; s < STATUS_OUT_PLUGIN_NUM_SHARDS; s++)
+				sum += bins_[s * stride_ + b];
+
+			merged_[b] = sum;
+			counter_ += sum;
+		}
+	}
+
+	unsigned int curr_pos_;
+	string dim_name_;
+	T bin_size_;
+	int min_index_;
+	int max_index_;
+	unsigned int num_bins_;
+
+	// Distance of the shards in bins_
+	unsigned int stride_;
+
+	// Bins of all shards
+	Buffer<ull_int> bins_;
+
+	// Merged histogram and its number of values
+	Buffer<ull_int> merged_;
+	ull_int counter_;
+};
+}
+#endif
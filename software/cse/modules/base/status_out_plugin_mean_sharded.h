@@ -0,0 +1,141 @@
+//
+//  This file is part of the Creonic simulation environment (CSE)
+//  for communication systems.
+//
+/// \file
+/// \brief  Sharded mean plug-in for the status out port
+/// \date   2026/10/19
+//
+
+#ifndef STATUS_OUT_PLUGIN_MEAN_SHARDED_H_
+#define STATUS_OUT_PLUGIN_MEAN_SHARDED_H_
+
+#include "status_out_plugin_abstract.h"
+
+/// Number of shards of the sharded plug-ins, i.e., maximum number of writing threads.
+#ifndef STATUS_OUT_PLUGIN_NUM_SHARDS
+#define STATUS_OUT_PLUGIN_NUM_SHARDS 16
+#endif
+
+/// Size of a cache line in bytes, shards are separated by at least this distance.
+#ifndef STATUS_OUT_PLUGIN_CACHE_LINE_SIZE
+#define STATUS_OUT_PLUGIN_CACHE_LINE_SIZE 64
+#endif
+
+namespace cse_lib{
+
+/// Mean value plug-in for the Status_Out port with one accumulator per writing thread.
+/**
+ * Same output as Status_Out_Plugin_Mean, but the sum and the number of values
+ * are kept in STATUS_OUT_PLUGIN_NUM_SHARDS shards. Each writing thread uses
+ * its own shard, e.g. its worker index, by Write(value, shard). As every shard
+ * has a single writer and the shards are separated by a cache line, no locks
+ * or atomic operations are required and the threads do not contend for cache
+ * lines. The shards are merged by Read() and Get_Value_Str(), which must not
+ * be called while other threads are writing.
+ *
+ * \ingroup status_out_plugin
+ */
+template<class T>
+class Status_Out_Plugin_Mean_Sharded : public Status_Out_Plugin_Abstract
+{
+public:
+
+	Status_Out_Plugin_Mean_Sharded()
+	{
+		Reset();
+		valid_flag_ = true;
+	}
+
+	/// Output data type of the plugin.
+	typedef float OUTPUT_TYPE;
+
+	/// Reset all shards of the plug-in
+	void Reset()
+	{
+		for (unsigned int i = 0; i < STATUS_OUT_PLUGIN_NUM_SHARDS; i++)
+		{
+			shards_[i].sum = 0;
+			shards_[i].number = 0;
+		}
+	}
+
+	/// Return the mean value of all shards, 0 if no value was written
+	OUTPUT_TYPE Read()
+	{
+		T sum = 0;
+		ull_int number = 0;
+
+		for (unsigned int i = 0; i < STATUS_OUT_PLUGIN_NUM_SHARDS; i++)
+		{
+			sum += shards_[i].sum;
+			number += shards_[i].number;
+		}
+
+		if (number == 0)
+			return 0;
+
+		return static_cast<OUTPUT_TYPE> (sum) / number;
+	}
+
+	/// Write the value into the first shard
+	/**
+	 *  \param value to add the the mean value
+	 */
+	void Write(T value)
+	{
+		shards_[0].sum += value;
+		shards_[0].number++;
+	}
+
+	/// Write the value into the shard of the calling thread
+	/**
+	 *  \param value to add the the mean value
+	 *  \param shard shard of the calling thread, 0 ... STATUS_OUT_PLUGIN_NUM_SHARDS - 1
+	 */
+	void Write(T value, unsigned int shard)
+	{
+		if (shard >= STATUS_OUT_PLUGIN_NUM_SHARDS)
+			shard %= STATUS_OUT_PLUGIN_NUM_SHARDS;
+
+		shards_[shard].sum += value;
+		shards_[shard].number++;
+	}
+
+	/// Gives one datum of the internal Buffer and returns true as long as data is available.
+	bool Get_Value_Str(Status_Out_Data_Struct& data)
+	{
+		ull_int number = 0;
+
+		for (unsigned int i = 0; i < STATUS_OUT_PLUGIN_NUM_SHARDS; i++)
+			number += shards_[i].number;
+
+		if(number != 0 && valid_flag_ == true)
+		{
+			data.value = Conv_Num_To_Str(Read());
+			valid_flag_ = false;
+			return true;
+		}
+		else
+		{
+			valid_flag_ = true;
+			return false;
+		}
+	}
+
+private:
+
+	// Accumulator of one thread, the padding keeps the accumulators of two shards apart.
+	struct Shard
+	{
+		T sum;
+		ull_int number;
+		char padding[STATUS_OUT_PLUGIN_CACHE_LINE_SIZE];
+	};
+
+	Shard shards_[STATUS_OUT_PLUGIN_NUM_SHARDS];
+
+	bool valid_flag_;
+};
+}
+#endif
@@ -78,6 +78,10 @@ protected:
 	/**
 	 * Before utilization, set init_time_ to clock(), since it initiates the
 	 * start point of measurement.
+	 *
+	 * clock() returns the CPU time of the whole process, so the result is
+	 * related to CPU time and not to wall-clock time. If several threads are
+	 * running it underestimates the throughput of each of them.
 	 */
 	float Calc_Throughput(ull_int amount_of_data)
 	{